@@ -0,0 +1,108 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include <mmm/mmm.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <span>
+#include <vector>
+
+//==================================================================================================
+// Compare raw MPI_Send/MPI_Recv with mmm::send/mmm::recv configured through options
+//
+// Ranks 0 and 1 play ping-pong with messages of increasing size. Half round-trip latencies are
+// expressed in microseconds; the best of several runs is kept to reduce noise. Both versions are
+// expected to perform identically as options are resolved at compile time.
+//==================================================================================================
+namespace
+{
+  constexpr int iterations  = 10000;
+  constexpr int runs        = 5;
+
+  template<typename F> double latency(F f)
+  {
+    double best = 1e300;
+
+    for(int r = 0; r < runs; ++r)
+    {
+      MPI_Barrier(MPI_COMM_WORLD);
+      auto start = std::chrono::steady_clock::now();
+      for(int i = 0; i < iterations; ++i) f();
+      std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+      best = std::min(best, d.count());
+    }
+
+    return best / iterations / 2 * 1e6;
+  }
+
+  void run(int rank, std::size_t n)
+  {
+    std::vector<double> buffer(n, 1.);
+    std::span<double>   data(buffer);
+    int peer  = 1 - rank;
+    int count = static_cast<int>(n);
+
+    auto raw = latency( [&]()
+                        {
+                          if(rank == 0)
+                          {
+                            MPI_Send(data.data(), count, MPI_DOUBLE, peer, 7, MPI_COMM_WORLD);
+                            MPI_Recv( data.data(), count, MPI_DOUBLE, peer, 7, MPI_COMM_WORLD
+                                    , MPI_STATUS_IGNORE
+                                    );
+                          }
+                          else
+                          {
+                            MPI_Recv( data.data(), count, MPI_DOUBLE, peer, 7, MPI_COMM_WORLD
+                                    , MPI_STATUS_IGNORE
+                                    );
+                            MPI_Send(data.data(), count, MPI_DOUBLE, peer, 7, MPI_COMM_WORLD);
+                          }
+                        }
+                      );
+
+    auto opt = latency( [&]()
+                        {
+                          if(rank == 0)
+                          {
+                            mmm::send[mmm::to = peer][mmm::tag = 7](data);
+                            mmm::recv[mmm::from = peer][mmm::tag = 7](data);
+                          }
+                          else
+                          {
+                            mmm::recv[mmm::from = peer][mmm::tag = 7](data);
+                            mmm::send[mmm::to = peer][mmm::tag = 7](data);
+                          }
+                        }
+                      );
+
+    if(rank == 0)
+    {
+      std::printf ( "%8zu B | MPI_Send %8.3f us | mmm::send[options] %8.3f us | ratio %5.3f\n"
+                  , n * sizeof(double), raw, opt, opt / raw
+                  );
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  mmm::context ctx(argc, argv);
+
+  if(ctx.size < 2)
+  {
+    if(ctx.rank == 0) std::printf("This benchmark requires at least 2 processes\n");
+    return 0;
+  }
+
+  if(ctx.rank > 1) return 0;
+
+  for(std::size_t n = 1; n <= (1 << 16); n *= 8) run(ctx.rank, n);
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include <mmm/mmm.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+//==================================================================================================
+// Compare mmm::packer, MPI_Pack and derived datatype transfers for usual layouts
+//
+// Each layout is packed into a contiguous buffer, then sent from its datatype to a contiguous
+// buffer of MPI_BYTE through MPI_COMM_SELF. Bandwidths are expressed in GB/s of useful data.
+//==================================================================================================
+namespace
+{
+  struct particle
+  {
+    double  x[3], v[3];
+    char    kind;
+    int     id;
+  };
+
+  constexpr int repetitions = 20;
+
+  template<typename F> double bandwidth(std::size_t bytes, F f)
+  {
+    f();
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < repetitions; ++i) f();
+    std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+
+    return static_cast<double>(bytes) * repetitions / d.count() / 1e9;
+  }
+
+  void run(char const* name, void const* data, int count, MPI_Datatype t)
+  {
+    mmm::packer       p(t);
+    auto              bytes = p.packed_size(count);
+    std::vector<char> buffer(bytes), reference(bytes);
+
+    auto mmm_pack = bandwidth(bytes, [&]() { p.pack(data, count, buffer.data()); });
+
+    auto mpi_pack = bandwidth ( bytes
+                              , [&]()
+                                {
+                                  int position = 0;
+                                  MPI_Pack( data, count, t, reference.data()
+                                          , static_cast<int>(bytes), &position, MPI_COMM_SELF
+                                          );
+                                }
+                              );
+
+    auto derived  = bandwidth ( bytes
+                              , [&]()
+                                {
+                                  MPI_Sendrecv( data, count, t, 0, 0
+                                              , reference.data(), static_cast<int>(bytes), MPI_BYTE
+                                              , 0, 0, MPI_COMM_SELF, MPI_STATUS_IGNORE
+                                              );
+                                }
+                              );
+
+    auto packed   = bandwidth ( bytes
+                              , [&]()
+                                {
+                                  p.pack(data, count, buffer.data());
+                                  MPI_Sendrecv( buffer.data(), static_cast<int>(bytes), MPI_BYTE
+                                              , 0, 0
+                                              , reference.data(), static_cast<int>(bytes), MPI_BYTE
+                                              , 0, 0, MPI_COMM_SELF, MPI_STATUS_IGNORE
+                                              );
+                                }
+                              );
+
+    auto valid = std::memcmp(buffer.data(), reference.data(), bytes) == 0;
+
+    std::printf ( "%-10s %8zu KB %6zu blocks | MPI_Pack %7.2f | mmm::packer %7.2f"
+                  " | derived send %7.2f | packed send %7.2f GB/s %s\n"
+                , name, bytes / 1024, p.blocks(), mpi_pack, mmm_pack, derived, packed
+                , valid ? "" : "(MISMATCH)"
+                );
+  }
+}
+
+int main(int argc, char** argv)
+{
+  mmm::context ctx(argc, argv);
+  if(ctx.rank != 0) return 0;
+
+  constexpr std::ptrdiff_t n = 1 << 20;
+
+  // Every other double of a large array
+  std::vector<double> values(2*n);
+  std::iota(values.begin(), values.end(), 0.);
+  run ( "vector", values.data(), 1
+      , mmm::datatype(mmm::view(values.data(), {n}, {2}))
+      );
+
+  // Blocks of 4 doubles spread irregularly
+  std::vector<int> starts(n/8);
+  for(std::size_t i = 0; i < starts.size(); ++i) starts[i] = static_cast<int>(8*i + (i*7) % 4);
+  mmm::indexed sel(values.data(), starts, 4);
+  run("indexed", values.data(), 1, mmm::datatype(sel));
+
+  // Array of padded structures
+  std::vector<particle> ps(n/4);
+  run("struct", ps.data(), static_cast<int>(ps.size()), mmm::datatype(mmm::type<particle>));
+
+  // Projection onto some members of a structure
+  auto fields = mmm::datatype(mmm::type<particle>, mmm::fields<&particle::x, &particle::id>);
+  run("fields", ps.data(), static_cast<int>(ps.size()), fields);
+
+  return 0;
+}
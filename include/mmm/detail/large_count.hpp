@@ -0,0 +1,484 @@
+//==================================================================================================
+/**
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if MPI_VERSION >= 4
+#define MMM_HAS_LARGE_COUNT
+#endif
+
+//==================================================================================================
+// Large-count transfers
+//
+// Every transfer performed by MMM goes through those helpers so that element counts are not
+// limited to INT_MAX. If the MPI library provides the MPI-4 large-count entry points, they are used
+// directly. Otherwise, transfers larger than a chunk are split into chunks of at most chunk_size
+// elements, each sent as its own message. Blocking transfers keep pipeline_depth chunks in flight
+// at any time so that chunks overlap on the wire.
+//
+// As chunks are separate messages, both ends of a large transfer must use the same count and
+// datatype and any wildcard source or tag is resolved by the first chunk. Point-to-point transfers
+// of at least chunk_size elements always end with a chunk shorter than chunk_size, possibly empty,
+// so that a receiver that doesn't know the count beforehand can tell where the transfer ends.
+//==================================================================================================
+namespace mmm::detail
+{
+#if defined(MMM_HAS_LARGE_COUNT)
+  using count_type        = MPI_Count;
+  using displacement_type = MPI_Aint;
+#else
+  using count_type        = int;
+  using displacement_type = int;
+#endif
+
+  // Can count be passed to a routine that is not split in chunks ?
+  constexpr bool fits_count(std::size_t count) noexcept
+  {
+    return count <= static_cast<std::size_t>(std::numeric_limits<count_type>::max());
+  }
+
+  // Number of elements per chunk when a transfer exceeds what an int can count
+  inline constexpr std::size_t chunk_size = std::size_t{1} << 30;
+
+  // Number of chunks in flight during a blocking pipelined transfer
+  inline constexpr int pipeline_depth = 4;
+
+  // Number of messages, and so of requests, used to transfer count elements
+  constexpr std::size_t chunk_count ( [[maybe_unused]] std::size_t count
+                                    , [[maybe_unused]] std::size_t chunk = chunk_size
+                                    ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return 1;
+#else
+    return count < chunk ? 1 : count / chunk + 1;
+#endif
+  }
+
+  inline MPI_Aint extent_of(MPI_Datatype t) noexcept
+  {
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(t, &lb, &extent);
+    return extent;
+  }
+
+  // Post chunks [first, count) through post while keeping at most pipeline_depth in flight
+  template<typename Post>
+  int pipeline(std::size_t first, std::size_t count, std::size_t chunk, Post post) noexcept
+  {
+    MPI_Request reqs[pipeline_depth];
+    int         k = 0;
+
+    for(std::size_t offset = first; offset < count; offset += chunk, ++k)
+    {
+      auto& r = reqs[k % pipeline_depth];
+      if(k >= pipeline_depth) MPI_Wait(&r, MPI_STATUS_IGNORE);
+
+      auto n = static_cast<int>(std::min(chunk, count - offset));
+      if(auto e = post(offset, n, &r); e != MPI_SUCCESS) return e;
+    }
+
+    return MPI_Waitall(std::min(k, pipeline_depth), reqs, MPI_STATUSES_IGNORE);
+  }
+
+  //================================================================================================
+  // Point-to-point
+  //================================================================================================
+  inline int send ( void const* buf, std::size_t count, MPI_Datatype t, int dest, int tag
+                  , MPI_Comm comm, [[maybe_unused]] std::size_t chunk = chunk_size
+                  ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Send_c(buf, static_cast<MPI_Count>(count), t, dest, tag, comm);
+#else
+    if(count < chunk) return MPI_Send(buf, static_cast<int>(count), t, dest, tag, comm);
+
+    auto base = static_cast<char const*>(buf);
+    auto ext  = extent_of(t);
+    auto e    = pipeline( 0, count, chunk
+                        , [&](std::size_t o, int n, MPI_Request* r)
+                          {
+                            return MPI_Isend(base + o * ext, n, t, dest, tag, comm, r);
+                          }
+                        );
+
+    // Full last chunks are followed by an empty one to delimit the transfer
+    if(e == MPI_SUCCESS && count % chunk == 0) e = MPI_Send(base, 0, t, dest, tag, comm);
+    return e;
+#endif
+  }
+
+  inline int recv ( void* buf, std::size_t count, MPI_Datatype t, int source, int tag
+                  , MPI_Comm comm, MPI_Status* status, [[maybe_unused]] std::size_t chunk = chunk_size
+                  ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Recv_c(buf, static_cast<MPI_Count>(count), t, source, tag, comm, status);
+#else
+    if(count < chunk) return MPI_Recv(buf, static_cast<int>(count), t, source, tag, comm, status);
+
+    auto base = static_cast<char*>(buf);
+    auto ext  = extent_of(t);
+
+    // The first chunk fixes the source and tag of all the following ones
+    MPI_Status first;
+    auto e = MPI_Recv(base, static_cast<int>(chunk), t, source, tag, comm, &first);
+    if(e != MPI_SUCCESS) return e;
+
+    e = pipeline( chunk, count, chunk
+                , [&](std::size_t o, int n, MPI_Request* r)
+                  {
+                    auto from = first.MPI_SOURCE, with = first.MPI_TAG;
+                    return MPI_Irecv(base + o * ext, n, t, from, with, comm, r);
+                  }
+                );
+
+    if(e == MPI_SUCCESS && count % chunk == 0)
+      e = MPI_Recv(base, 0, t, first.MPI_SOURCE, first.MPI_TAG, comm, MPI_STATUS_IGNORE);
+
+    if(status != MPI_STATUS_IGNORE)
+    {
+      *status = first;
+      MPI_Status_set_elements_x(status, t, static_cast<MPI_Count>(count));
+    }
+
+    return e;
+#endif
+  }
+
+  // Post a nonblocking send using chunk_count(count, chunk) requests stored in reqs
+  inline int isend( void const* buf, std::size_t count, MPI_Datatype t, int dest, int tag
+                  , MPI_Comm comm, MPI_Request* reqs, [[maybe_unused]] std::size_t chunk = chunk_size
+                  ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Isend_c(buf, static_cast<MPI_Count>(count), t, dest, tag, comm, reqs);
+#else
+    auto base = static_cast<char const*>(buf);
+    auto ext  = extent_of(t);
+
+    for(std::size_t i = 0, k = chunk_count(count, chunk); i < k; ++i, ++reqs)
+    {
+      auto o = i * chunk;
+      auto n = static_cast<int>(std::min(chunk, count - o));
+      if(auto e = MPI_Isend(base + o * ext, n, t, dest, tag, comm, reqs); e != MPI_SUCCESS) return e;
+    }
+
+    return MPI_SUCCESS;
+#endif
+  }
+
+  // Post a nonblocking receive using chunk_count(count, chunk) requests stored in reqs
+  // Large receives must not use wildcards as chunks can't be tied to a single sender beforehand
+  inline int irecv( void* buf, std::size_t count, MPI_Datatype t, int source, int tag
+                  , MPI_Comm comm, MPI_Request* reqs, [[maybe_unused]] std::size_t chunk = chunk_size
+                  ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Irecv_c(buf, static_cast<MPI_Count>(count), t, source, tag, comm, reqs);
+#else
+    auto base = static_cast<char*>(buf);
+    auto ext  = extent_of(t);
+
+    for(std::size_t i = 0, k = chunk_count(count, chunk); i < k; ++i, ++reqs)
+    {
+      auto o = i * chunk;
+      auto n = static_cast<int>(std::min(chunk, count - o));
+      if(auto e = MPI_Irecv(base + o * ext, n, t, source, tag, comm, reqs); e != MPI_SUCCESS) return e;
+    }
+
+    return MPI_SUCCESS;
+#endif
+  }
+
+  // Post a nonblocking send of at most chunk_size elements as a single request
+  inline int isend_chunk( void const* buf, std::size_t count, MPI_Datatype t, int dest, int tag
+                        , MPI_Comm comm, MPI_Request* req
+                        ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Isend_c(buf, static_cast<MPI_Count>(count), t, dest, tag, comm, req);
+#else
+    return MPI_Isend(buf, static_cast<int>(count), t, dest, tag, comm, req);
+#endif
+  }
+
+  // Post a nonblocking receive of at most chunk_size elements as a single request
+  inline int irecv_chunk( void* buf, std::size_t count, MPI_Datatype t, int source, int tag
+                        , MPI_Comm comm, MPI_Request* req
+                        ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Irecv_c(buf, static_cast<MPI_Count>(count), t, source, tag, comm, req);
+#else
+    return MPI_Irecv(buf, static_cast<int>(count), t, source, tag, comm, req);
+#endif
+  }
+
+  // Build a persistent send of at most chunk_size elements
+  inline int send_init( void const* buf, std::size_t count, MPI_Datatype t, int dest, int tag
+                      , MPI_Comm comm, MPI_Request* req
+                      ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Send_init_c(buf, static_cast<MPI_Count>(count), t, dest, tag, comm, req);
+#else
+    return MPI_Send_init(buf, static_cast<int>(count), t, dest, tag, comm, req);
+#endif
+  }
+
+  // Build a persistent receive of at most chunk_size elements
+  inline int recv_init( void* buf, std::size_t count, MPI_Datatype t, int source, int tag
+                      , MPI_Comm comm, MPI_Request* req
+                      ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Recv_init_c(buf, static_cast<MPI_Count>(count), t, source, tag, comm, req);
+#else
+    return MPI_Recv_init(buf, static_cast<int>(count), t, source, tag, comm, req);
+#endif
+  }
+
+  // Number of elements of type t received according to status
+  inline std::size_t count_of(MPI_Status const& status, MPI_Datatype t) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    MPI_Count n;
+    MPI_Get_count_c(&status, t, &n);
+#else
+    int n;
+    MPI_Get_count(&status, t, &n);
+#endif
+    return n == MPI_UNDEFINED ? 0 : static_cast<std::size_t>(n);
+  }
+
+  // Receive a message matched by MPI_Mprobe as a single message
+  inline int mrecv( void* buf, std::size_t count, MPI_Datatype t, MPI_Message* msg
+                  , MPI_Status* status
+                  ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Mrecv_c(buf, static_cast<MPI_Count>(count), t, msg, status);
+#else
+    return MPI_Mrecv(buf, static_cast<int>(count), t, msg, status);
+#endif
+  }
+
+  //================================================================================================
+  // Collectives
+  //================================================================================================
+  inline int bcast( void* buf, std::size_t count, MPI_Datatype t, int root, MPI_Comm comm
+                  , [[maybe_unused]] std::size_t chunk = chunk_size
+                  ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Bcast_c(buf, static_cast<MPI_Count>(count), t, root, comm);
+#else
+    if(count <= chunk) return MPI_Bcast(buf, static_cast<int>(count), t, root, comm);
+
+    auto base = static_cast<char*>(buf);
+    auto ext  = extent_of(t);
+    return pipeline ( 0, count, chunk
+                    , [&](std::size_t o, int n, MPI_Request* r)
+                      {
+                        return MPI_Ibcast(base + o * ext, n, t, root, comm, r);
+                      }
+                    );
+#endif
+  }
+
+  inline int allreduce( void const* in, void* out, std::size_t count, MPI_Datatype t, MPI_Op op
+                      , MPI_Comm comm, [[maybe_unused]] std::size_t chunk = chunk_size
+                      ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Allreduce_c(in, out, static_cast<MPI_Count>(count), t, op, comm);
+#else
+    if(count <= chunk) return MPI_Allreduce(in, out, static_cast<int>(count), t, op, comm);
+
+    auto src  = static_cast<char const*>(in);
+    auto dst  = static_cast<char*>(out);
+    auto ext  = extent_of(t);
+    return pipeline ( 0, count, chunk
+                    , [&](std::size_t o, int n, MPI_Request* r)
+                      {
+                        auto s = (in == MPI_IN_PLACE) ? MPI_IN_PLACE : src + o * ext;
+                        return MPI_Iallreduce(s, dst + o * ext, n, t, op, comm, r);
+                      }
+                    );
+#endif
+  }
+
+  //================================================================================================
+  // Neighborhood collectives
+  //
+  // Neighborhood collectives can't be split in chunks as each neighbor may receive a different
+  // part of the data. Without the MPI-4 entry points, counts and displacements that an int can't
+  // represent are rejected with MPI_ERR_COUNT and nothing is posted.
+  //================================================================================================
+  inline int neighbor_allgather ( void const* in, std::size_t count, MPI_Datatype t, void* out
+                                , MPI_Comm comm
+                                ) noexcept
+  {
+    if(!fits_count(count)) return MPI_ERR_COUNT;
+    auto n = static_cast<count_type>(count);
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Neighbor_allgather_c(in, n, t, out, n, t, comm);
+#else
+    return MPI_Neighbor_allgather(in, n, t, out, n, t, comm);
+#endif
+  }
+
+  inline int ineighbor_allgather( void const* in, std::size_t count, MPI_Datatype t, void* out
+                                , MPI_Comm comm, MPI_Request* req
+                                ) noexcept
+  {
+    if(!fits_count(count)) return MPI_ERR_COUNT;
+    auto n = static_cast<count_type>(count);
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Ineighbor_allgather_c(in, n, t, out, n, t, comm, req);
+#else
+    return MPI_Ineighbor_allgather(in, n, t, out, n, t, comm, req);
+#endif
+  }
+
+  inline int neighbor_alltoall( void const* in, std::size_t count, MPI_Datatype t, void* out
+                              , MPI_Comm comm
+                              ) noexcept
+  {
+    if(!fits_count(count)) return MPI_ERR_COUNT;
+    auto n = static_cast<count_type>(count);
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Neighbor_alltoall_c(in, n, t, out, n, t, comm);
+#else
+    return MPI_Neighbor_alltoall(in, n, t, out, n, t, comm);
+#endif
+  }
+
+  inline int ineighbor_alltoall ( void const* in, std::size_t count, MPI_Datatype t, void* out
+                                , MPI_Comm comm, MPI_Request* req
+                                ) noexcept
+  {
+    if(!fits_count(count)) return MPI_ERR_COUNT;
+    auto n = static_cast<count_type>(count);
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Ineighbor_alltoall_c(in, n, t, out, n, t, comm, req);
+#else
+    return MPI_Ineighbor_alltoall(in, n, t, out, n, t, comm, req);
+#endif
+  }
+
+  // Counts and displacements of the blocks sent, then received, by a vector neighborhood collective
+  inline int neighbor_layout( std::span<std::size_t const> sends
+                            , std::span<std::size_t const> recvs
+                            , std::vector<count_type>&        counts
+                            , std::vector<displacement_type>& displs
+                            )
+  {
+    counts.clear();
+    displs.clear();
+    counts.reserve(sends.size() + recvs.size());
+    displs.reserve(sends.size() + recvs.size());
+
+    for(auto blocks : {sends, recvs})
+    {
+      std::size_t offset = 0;
+      for(auto n : blocks)
+      {
+        if(!std::in_range<count_type>(n) || !std::in_range<displacement_type>(offset))
+          return MPI_ERR_COUNT;
+
+        counts.push_back(static_cast<count_type>(n));
+        displs.push_back(static_cast<displacement_type>(offset));
+        offset += n;
+      }
+    }
+
+    return MPI_SUCCESS;
+  }
+
+  // Counts and displacements are stored in c and d, which must outlive the collective
+  inline int ineighbor_alltoallv( void const* in , std::span<std::size_t const> sends
+                                , void*       out, std::span<std::size_t const> recvs
+                                , MPI_Datatype t, MPI_Comm comm
+                                , std::vector<count_type>& c, std::vector<displacement_type>& d
+                                , MPI_Request* req
+                                )
+  {
+    if(auto e = neighbor_layout(sends, recvs, c, d); e != MPI_SUCCESS) return e;
+
+    auto sc = c.data(), rc = sc + sends.size();
+    auto sd = d.data(), rd = sd + sends.size();
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Ineighbor_alltoallv_c(in, sc, sd, t, out, rc, rd, t, comm, req);
+#else
+    return MPI_Ineighbor_alltoallv(in, sc, sd, t, out, rc, rd, t, comm, req);
+#endif
+  }
+
+  inline int neighbor_alltoallv ( void const* in , std::span<std::size_t const> sends
+                                , void*       out, std::span<std::size_t const> recvs
+                                , MPI_Datatype t, MPI_Comm comm
+                                )
+  {
+    std::vector<count_type>         c;
+    std::vector<displacement_type>  d;
+    if(auto e = neighbor_layout(sends, recvs, c, d); e != MPI_SUCCESS) return e;
+
+    auto sc = c.data(), rc = sc + sends.size();
+    auto sd = d.data(), rd = sd + sends.size();
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Neighbor_alltoallv_c(in, sc, sd, t, out, rc, rd, t, comm);
+#else
+    return MPI_Neighbor_alltoallv(in, sc, sd, t, out, rc, rd, t, comm);
+#endif
+  }
+
+  // Regions are located by their absolute address and sent as one element of their datatype
+  inline int neighbor_alltoallw ( count_type const* c, MPI_Aint const* d, MPI_Datatype const* t
+                                , std::size_t sends, MPI_Comm comm
+                                ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Neighbor_alltoallw_c ( MPI_BOTTOM, c        , d        , t
+                                    , MPI_BOTTOM, c + sends, d + sends, t + sends
+                                    , comm
+                                    );
+#else
+    return MPI_Neighbor_alltoallw ( MPI_BOTTOM, c        , d        , t
+                                  , MPI_BOTTOM, c + sends, d + sends, t + sends
+                                  , comm
+                                  );
+#endif
+  }
+
+  inline int ineighbor_alltoallw( count_type const* c, MPI_Aint const* d, MPI_Datatype const* t
+                                , std::size_t sends, MPI_Comm comm, MPI_Request* req
+                                ) noexcept
+  {
+#if defined(MMM_HAS_LARGE_COUNT)
+    return MPI_Ineighbor_alltoallw_c( MPI_BOTTOM, c        , d        , t
+                                    , MPI_BOTTOM, c + sends, d + sends, t + sends
+                                    , comm, req
+                                    );
+#else
+    return MPI_Ineighbor_alltoallw( MPI_BOTTOM, c        , d        , t
+                                  , MPI_BOTTOM, c + sends, d + sends, t + sends
+                                  , comm, req
+                                  );
+#endif
+  }
+}
@@ -47,7 +47,7 @@ namespace mmm
   template<typename Tag, typename... Ps>
   using tag_dispatch_result_t = std::invoke_result_t<decltype(mmm::tag_dispatch), Tag, Ps...>;
 
-  template<auto& Tag> using tag = std::decay_t<decltype(Tag)>;
+  template<auto& Tag> using tag_of = std::decay_t<decltype(Tag)>;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -79,10 +79,10 @@ namespace mmm
       }
 
       template<typename... Ps>
-      MMM_FORCEINLINE auto operator()(Ps const&... x) const
-      -> mmm::tag_dispatch_result_t<Tag, Settings const&, Ps const&...>
+      MMM_FORCEINLINE auto operator()(Ps&&... x) const
+      -> mmm::tag_dispatch_result_t<Tag, Settings const&, Ps...>
       {
-        return tag_dispatch(Tag{}, opts, x...);
+        return tag_dispatch(Tag{}, opts, MMM_FWD(x)...);
       }
 
       Settings opts;
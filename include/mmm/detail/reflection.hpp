@@ -0,0 +1,120 @@
+//==================================================================================================
+/**
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#pragma once
+
+#include <mmm/detail/kumi.hpp>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//==================================================================================================
+// Minimal aggregate reflection
+//
+// Aggregates are turned into kumi::tuple of references to their members by counting how many
+// braced initializers they accept and by decomposing them via structured bindings.
+//==================================================================================================
+namespace mmm::detail
+{
+  // Maximum number of members supported by aggregate reflection
+  inline constexpr std::size_t max_fields = 32;
+
+  // Type convertible to anything, used to probe aggregate initialization
+  struct any_field
+  {
+    template<typename T> constexpr operator T() const noexcept;
+  };
+
+  template<std::size_t> using any_field_t = any_field;
+
+  // Each member is initialized from its own braced list so C arrays count as a single member
+  template<typename T, std::size_t... I>
+  constexpr bool is_brace_constructible(std::index_sequence<I...>) noexcept
+  {
+    return requires { T{ {any_field_t<I>{}}... }; };
+  }
+
+  // Probing stops one past max_fields so that oversized aggregates can be diagnosed
+  template<typename T, std::size_t N = 0>
+  constexpr std::size_t count_fields() noexcept
+  {
+    if constexpr(N > max_fields) return N;
+    else if constexpr(!is_brace_constructible<T>(std::make_index_sequence<N+1>{})) return N;
+    else return count_fields<T,N+1>();
+  }
+
+  // Types behaving like std::tuple
+  template<typename T>
+  concept tuple_like = requires { std::tuple_size<T>::value; };
+
+  // Aggregates we can decompose member by member
+  template<typename T>
+  concept reflectable =   std::is_aggregate_v<T> && !std::is_array_v<T> && !tuple_like<T>
+                      &&  std::is_class_v<T> && !std::is_union_v<T>;
+
+  template<reflectable T>
+  inline constexpr std::size_t field_count = count_fields<T>();
+
+  //================================================================================================
+  // Turns an aggregate into a kumi::tuple of references to its members
+  //================================================================================================
+  template<reflectable T> constexpr auto tie_fields(T& x) noexcept
+  {
+    constexpr auto N = field_count<T>;
+    static_assert(N <= max_fields, "[MMM] - Aggregate has too many members to be reflected");
+
+    if      constexpr(N ==  0) { return kumi::tuple<>{}; }
+    else if constexpr(N ==  1) { auto& [m0] = x; return kumi::tie(m0); }
+    else if constexpr(N ==  2) { auto& [m0, m1] = x; return kumi::tie(m0, m1); }
+    else if constexpr(N ==  3) { auto& [m0, m1, m2] = x; return kumi::tie(m0, m1, m2); }
+    else if constexpr(N ==  4) { auto& [m0, m1, m2, m3] = x; return kumi::tie(m0, m1, m2, m3); }
+    else if constexpr(N ==  5) { auto& [m0, m1, m2, m3, m4] = x; return kumi::tie(m0, m1, m2, m3, m4); }
+    else if constexpr(N ==  6) { auto& [m0, m1, m2, m3, m4, m5] = x; return kumi::tie(m0, m1, m2, m3, m4, m5); }
+    else if constexpr(N ==  7) { auto& [m0, m1, m2, m3, m4, m5, m6] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6); }
+    else if constexpr(N ==  8) { auto& [m0, m1, m2, m3, m4, m5, m6, m7] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7); }
+    else if constexpr(N ==  9) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8); }
+    else if constexpr(N == 10) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9); }
+    else if constexpr(N == 11) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10); }
+    else if constexpr(N == 12) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11); }
+    else if constexpr(N == 13) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12); }
+    else if constexpr(N == 14) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13); }
+    else if constexpr(N == 15) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14); }
+    else if constexpr(N == 16) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15); }
+    else if constexpr(N == 17) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16); }
+    else if constexpr(N == 18) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17); }
+    else if constexpr(N == 19) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18); }
+    else if constexpr(N == 20) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19); }
+    else if constexpr(N == 21) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20); }
+    else if constexpr(N == 22) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21); }
+    else if constexpr(N == 23) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22); }
+    else if constexpr(N == 24) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23); }
+    else if constexpr(N == 25) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24); }
+    else if constexpr(N == 26) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25); }
+    else if constexpr(N == 27) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26); }
+    else if constexpr(N == 28) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27); }
+    else if constexpr(N == 29) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28); }
+    else if constexpr(N == 30) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29); }
+    else if constexpr(N == 31) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30); }
+    else if constexpr(N == 32) { auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31] = x; return kumi::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31); }
+  }
+
+  // Turns a tuple-like type into a kumi::tuple of references to its elements
+  template<tuple_like T> constexpr auto tie_fields(T& x) noexcept
+  {
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+      using std::get;
+      return kumi::tie(get<I>(x)...);
+    }(std::make_index_sequence<std::tuple_size<T>::value>{});
+  }
+
+  // Types of the fields of T as a kumi::tuple
+  template<typename T>
+  using fields_t = kumi::as_tuple_t<decltype(tie_fields(std::declval<T&>())), std::remove_cvref>;
+}
@@ -0,0 +1,292 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <unordered_map>
+#include <vector>
+
+namespace mmm::detail
+{
+  //================================================================================================
+  // Type identifiers
+  //
+  // Each distinct list of key types receives a unique, dense index during static initialization.
+  // Those indexes are used to locate the datatype associated to a type in the registry.
+  //================================================================================================
+  inline std::atomic<std::size_t>& type_counter() noexcept
+  {
+    static std::atomic<std::size_t> count{0};
+    return count;
+  }
+
+  template<typename... Keys>
+  inline std::size_t const type_id = type_counter().fetch_add(1, std::memory_order_relaxed);
+
+  //================================================================================================
+  // Runtime patterns
+  //
+  // Datatypes built from runtime values, like extents or indexes, are identified by their key
+  // types and by the list of integers they were built from. This list is given as several ranges
+  // of integers which concatenation must be unambiguous for a given list of key types.
+  //================================================================================================
+  template<typename... Parts>
+  constexpr std::size_t hash_pattern(Parts const&... parts) noexcept
+  {
+    // FNV-1a over the whole pattern
+    std::size_t h = 14695981039346656037ULL;
+    auto mix = [&](auto const& part)
+    {
+      for(auto v : part) h = (h ^ static_cast<std::size_t>(v)) * 1099511628211ULL;
+    };
+
+    (mix(parts), ...);
+    return h;
+  }
+
+  //================================================================================================
+  // Registry of derived datatypes and user-defined operations
+  //
+  // Datatypes and operations associated to a type identifier are stored in tables of atomic slots
+  // sized after the number of identifiers known when the registry is built, so that finding them
+  // is a single array access with no lock. Identifiers created afterward, e.g by dynamically
+  // loaded code, are stored in a map protected by the same mutex used when building handles. This
+  // mutex is recursive as building a datatype may require the datatypes of its members.
+  //
+  // Datatypes built from runtime patterns are cached in a hash table, also behind this mutex, and
+  // datatypes built from any other runtime values are adopted by the registry so that all of them
+  // are released at once before MPI is finalized.
+  //================================================================================================
+  struct registry
+  {
+    registry()
+      : types_(type_counter().load(), MPI_DATATYPE_NULL)
+      , ops_(type_counter().load(), MPI_OP_NULL)
+    {}
+
+    ~registry() { release(); }
+
+    registry(registry const&)             = delete;
+    registry& operator=(registry const&)  = delete;
+
+    // Retrieve the datatype associated to Keys, building and committing it on first access
+    template<typename... Keys, typename Builder>
+    MPI_Datatype get(Builder build)
+    {
+      auto id = type_id<Keys...>;
+      if(auto t = types_.find(id); t != MPI_DATATYPE_NULL) return t;
+
+      std::lock_guard lock(mutex_);
+
+      // Another thread may have built the datatype while this one was waiting
+      if(auto t = types_.find_locked(id); t != MPI_DATATYPE_NULL) return t;
+
+      MPI_Datatype t = build();
+      MPI_Type_commit(&t);
+      owned_.push_back(t);
+      types_.store(id, t);
+
+      return t;
+    }
+
+    // Retrieve the datatype associated to Keys and a runtime pattern, building and committing it
+    // on first access
+    template<typename... Keys, typename Builder, typename... Parts>
+    MPI_Datatype get(std::size_t hash, Builder build, Parts const&... parts)
+    {
+      auto id = type_id<Keys...>;
+
+      std::lock_guard lock(mutex_);
+
+      auto [first, last] = patterns_.equal_range(hash);
+      for(auto it = first; it != last; ++it)
+        if(it->second.id == id && it->second.match(parts...)) return it->second.type;
+
+      // Patterns that can't be described by a datatype are not cached
+      MPI_Datatype t = build();
+      if(t == MPI_DATATYPE_NULL) return t;
+
+      MPI_Type_commit(&t);
+      owned_.push_back(t);
+
+      pattern_entry e{id, {}, t};
+      (e.values.insert(e.values.end(), std::ranges::begin(parts), std::ranges::end(parts)), ...);
+      patterns_.emplace(hash, std::move(e));
+
+      return t;
+    }
+
+    // Retrieve the user-defined operation associated to Keys, creating it on first access
+    template<typename... Keys, typename Builder>
+    MPI_Op operation(Builder build)
+    {
+      auto id = type_id<Keys...>;
+      if(auto o = ops_.find(id); o != MPI_OP_NULL) return o;
+
+      std::lock_guard lock(mutex_);
+      if(auto o = ops_.find_locked(id); o != MPI_OP_NULL) return o;
+
+      MPI_Op o = build();
+      owned_ops_.push_back(o);
+      ops_.store(id, o);
+
+      return o;
+    }
+
+    // Commit a datatype built from runtime values and take its ownership
+    MPI_Datatype adopt(MPI_Datatype t)
+    {
+      MPI_Type_commit(&t);
+
+      std::lock_guard lock(mutex_);
+      owned_.push_back(t);
+      return t;
+    }
+
+    // Free all registered datatypes and operations
+    void release() noexcept
+    {
+      int done;
+      MPI_Finalized(&done);
+
+      std::lock_guard lock(mutex_);
+      for(auto& t : owned_)     if(!done) MPI_Type_free(&t);
+      for(auto& o : owned_ops_) if(!done) MPI_Op_free(&o);
+      owned_.clear();
+      owned_ops_.clear();
+
+      types_.clear();
+      ops_.clear();
+      patterns_.clear();
+    }
+
+    private:
+    // Handles indexed by type identifier
+    template<typename Handle> struct table
+    {
+      table(std::size_t n, Handle null)
+        : size(n), none(null), slots(std::make_unique<std::atomic<Handle>[]>(n))
+      {
+        clear();
+      }
+
+      Handle find(std::size_t id) const noexcept
+      {
+        return id < size ? slots[id].load(std::memory_order_acquire) : none;
+      }
+
+      // Must be called with the registry mutex held
+      Handle find_locked(std::size_t id) const
+      {
+        if(id < size) return slots[id].load(std::memory_order_relaxed);
+        auto it = overflow.find(id);
+        return it != overflow.end() ? it->second : none;
+      }
+
+      void store(std::size_t id, Handle h)
+      {
+        if(id < size) slots[id].store(h, std::memory_order_release);
+        else          overflow.emplace(id, h);
+      }
+
+      void clear() noexcept
+      {
+        for(std::size_t i = 0; i < size; ++i) slots[i].store(none);
+        overflow.clear();
+      }
+
+      std::size_t                             size;
+      Handle                                  none;
+      std::unique_ptr<std::atomic<Handle>[]>  slots;
+      std::unordered_map<std::size_t, Handle> overflow;
+    };
+
+    struct pattern_entry
+    {
+      template<typename... Parts> bool match(Parts const&... parts) const noexcept
+      {
+        if(values.size() != (static_cast<std::size_t>(std::ranges::size(parts)) + ... + 0))
+          return false;
+
+        auto it   = values.begin();
+        auto same = [&](auto const& part)
+        {
+          for(auto v : part) if(*it++ != static_cast<std::ptrdiff_t>(v)) return false;
+          return true;
+        };
+
+        return (same(parts) && ...);
+      }
+
+      std::size_t                 id;
+      std::vector<std::ptrdiff_t> values;
+      MPI_Datatype                type;
+    };
+
+    table<MPI_Datatype>                                 types_;
+    table<MPI_Op>                                       ops_;
+    std::unordered_multimap<std::size_t, pattern_entry> patterns_;
+    std::vector<MPI_Datatype>                           owned_;
+    std::vector<MPI_Op>                                 owned_ops_;
+    std::recursive_mutex                                mutex_;
+  };
+
+  //================================================================================================
+  // Active registry
+  //
+  // Every living mmm::context or mmm::session owns a registry and attaches it on construction. The
+  // registry attached last is the active one and is detached when its owner is destroyed, in any
+  // order, so that the previous one becomes active again. Without any attached registry, datatypes
+  // are kept in a process-wide fallback registry, e.g when MPI is initialized by the user.
+  //================================================================================================
+  inline std::atomic<registry*>& active_registry() noexcept
+  {
+    static std::atomic<registry*> current = nullptr;
+    return current;
+  }
+
+  inline std::mutex& registries_mutex() noexcept
+  {
+    static std::mutex m;
+    return m;
+  }
+
+  inline std::vector<registry*>& attached_registries() noexcept
+  {
+    static std::vector<registry*> all;
+    return all;
+  }
+
+  inline void attach(registry& r)
+  {
+    std::lock_guard lock(registries_mutex());
+    attached_registries().push_back(&r);
+    active_registry().store(&r, std::memory_order_release);
+  }
+
+  inline void detach(registry& r)
+  {
+    std::lock_guard lock(registries_mutex());
+    auto& all = attached_registries();
+    std::erase(all, &r);
+    active_registry().store(all.empty() ? nullptr : all.back(), std::memory_order_release);
+  }
+
+  inline registry& types() noexcept
+  {
+    if(auto r = active_registry().load(std::memory_order_acquire)) return *r;
+
+    static registry fallback;
+    return fallback;
+  }
+}
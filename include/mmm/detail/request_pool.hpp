@@ -0,0 +1,99 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mmm::detail
+{
+  //================================================================================================
+  // Pool of request handles
+  //
+  // Each pending operation is tracked by one or more nodes holding a MPI_Request, chained when a
+  // large transfer is split in several messages. Nodes are allocated by slabs and recycled through
+  // a per-thread free list, so that posting requests never touches the heap once the pool reached
+  // the maximum number of requests in flight.
+  //
+  // Slabs are kept alive until the program ends so that a request can be completed and recycled
+  // by another thread than the one it was posted from.
+  //================================================================================================
+  struct request_node
+  {
+    MPI_Request   handle;
+    request_node* next;
+  };
+
+  struct request_pool
+  {
+    static constexpr std::size_t slab_size = 256;
+
+    request_pool()                                = default;
+    request_pool(request_pool const&)             = delete;
+    request_pool& operator=(request_pool const&)  = delete;
+
+    // Get an unlinked node holding MPI_REQUEST_NULL
+    request_node* acquire()
+    {
+      if(!free_) refill();
+
+      auto n  = free_;
+      free_   = n->next;
+      *n      = request_node{MPI_REQUEST_NULL, nullptr};
+      return n;
+    }
+
+    // Give back a chain of nodes
+    void release(request_node* n) noexcept
+    {
+      while(n)
+      {
+        auto next = n->next;
+        n->next   = free_;
+        free_     = n;
+        n         = next;
+      }
+    }
+
+    private:
+    void refill()
+    {
+      auto slab = std::make_unique<request_node[]>(slab_size);
+      for(std::size_t i = 0; i+1 < slab_size; ++i) slab[i].next = &slab[i+1];
+      slab[slab_size-1].next = free_;
+      free_ = &slab[0];
+
+      std::lock_guard lock(slabs_mutex());
+      slabs().push_back(std::move(slab));
+    }
+
+    static std::vector<std::unique_ptr<request_node[]>>& slabs()
+    {
+      static std::vector<std::unique_ptr<request_node[]>> all;
+      return all;
+    }
+
+    static std::mutex& slabs_mutex()
+    {
+      static std::mutex m;
+      return m;
+    }
+
+    request_node* free_ = nullptr;
+  };
+
+  // Pool of the current thread
+  inline request_pool& requests() noexcept
+  {
+    thread_local request_pool pool;
+    return pool;
+  }
+}
@@ -11,3 +11,4 @@
 namespace mmm {}
 
 #include <mmm/system.hpp>
+#include <mmm/p2p.hpp>
@@ -0,0 +1,16 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mmm/p2p/irecv.hpp>
+#include <mmm/p2p/isend.hpp>
+#include <mmm/p2p/message.hpp>
+#include <mmm/p2p/recv.hpp>
+#include <mmm/p2p/recv_init.hpp>
+#include <mmm/p2p/send.hpp>
+#include <mmm/p2p/send_init.hpp>
@@ -0,0 +1,116 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/overload.hpp>
+#include <mmm/p2p/message.hpp>
+#include <mmm/system/options.hpp>
+#include <mmm/system/request.hpp>
+
+namespace mmm::tags
+{
+  struct irecv_ : callable<irecv_>, support_options<irecv_>
+  {
+    using callable<irecv_>::operator();
+    using support_options<irecv_>::operator[];
+
+    template<typename T>
+    auto operator()(T& x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD) const
+    -> decltype(tag_dispatch(*this, x, source, tag, comm))
+    {
+      return tag_dispatch(*this, x, source, tag, comm);
+    }
+
+    template<typename T>
+    requires detail::dangling_message<T>
+    request operator()(T&& x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD) const = delete;
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var irecv
+  //! @brief irecv object function starting a nonblocking receive of a value or a contiguous range
+  //!
+  //! **Defined in Header**
+  //!
+  //! @code
+  //! #include <mmm/p2p/irecv.hpp>
+  //! @endcode
+  //!
+  //! @groupheader{Callable Signatures}
+  //!
+  //! @code
+  //! namespace mmm
+  //! {
+  //!   template<typename T>
+  //!   mmm::request irecv(T& x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD);
+  //!
+  //!   template<typename T>
+  //!   mmm::request irecv[mmm::from = source][mmm::tag = tag][mmm::comm = comm](T& x);
+  //! }
+  //! @endcode
+  //!
+  //! **Parameters:**
+  //!
+  //!   * `x`       : Value to receive into. It must not be accessed until the receive completes.
+  //!   * `source`  : Rank of the source process in `comm` or `MPI_ANY_SOURCE`.
+  //!   * `tag`     : Tag of the message or `MPI_ANY_TAG`.
+  //!   * `comm`    : Communicator to receive the message from.
+  //!
+  //! **Options:**
+  //!
+  //!   * mmm::from               : Rank of the source process. Defaults to `MPI_ANY_SOURCE`.
+  //!   * mmm::tag                : Tag of the message. Defaults to `MPI_ANY_TAG`.
+  //!   * mmm::comm               : Communicator to receive the message from. Defaults to
+  //!                               `MPI_COMM_WORLD`.
+  //!   * mmm::cancel_on_destroy  : Cancel the receive if the request is destroyed while pending.
+  //!
+  //! **Return value:**
+  //!
+  //! A mmm::request tracking the receive.
+  //!
+  //! `x` can be a value which type has an associated [datatype](@ref mmm::datatype) or a
+  //! contiguous range of such values. Ranges are not resized: they receive as many elements as
+  //! they contain. Temporaries are rejected at compile time, except for views like `std::span`
+  //! referring to storage owned elsewhere. Wildcards must not be used for messages larger than
+  //! what an `int` can count without MPI-4 support.
+  //!
+  //================================================================================================
+  inline constexpr tags::irecv_ irecv = {};
+}
+
+namespace mmm::tags
+{
+  template<detail::immediate_message T>
+  requires(!std::is_const_v<T>)
+  request tag_dispatch(irecv_ const&, T& x, int source, int tag, MPI_Comm comm)
+  {
+    return detail::irecv_message(x, source, tag, comm, request::wait_on_destroy);
+  }
+
+  template<rbr::concepts::settings Settings, typename T>
+  requires(     detail::immediate_message<std::remove_cvref_t<T>>
+            &&  !std::is_const_v<std::remove_reference_t<T>>
+            &&  !detail::dangling_message<T>
+          )
+  MMM_FORCEINLINE request tag_dispatch(irecv_ const&, Settings const& s, T&& x)
+  {
+    constexpr auto p  = decltype(s[mmm::cancel_on_destroy])::value ? request::cancel_on_destroy
+                                                                    : request::wait_on_destroy;
+    return detail::irecv_message( x, s[mmm::from | MPI_ANY_SOURCE], s[mmm::tag | MPI_ANY_TAG]
+                                , s[mmm::comm | MPI_COMM_WORLD], p
+                                );
+  }
+
+  template<rbr::concepts::settings Settings, typename T>
+  requires detail::dangling_message<T>
+  request tag_dispatch(irecv_ const&, Settings const& s, T&& x) = delete;
+}
@@ -0,0 +1,115 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/overload.hpp>
+#include <mmm/p2p/message.hpp>
+#include <mmm/system/options.hpp>
+#include <mmm/system/request.hpp>
+
+namespace mmm::tags
+{
+  struct isend_ : callable<isend_>, support_options<isend_>
+  {
+    using callable<isend_>::operator();
+    using support_options<isend_>::operator[];
+
+    template<typename T>
+    auto operator()(T const& x, int dest, int tag, MPI_Comm comm = MPI_COMM_WORLD) const
+    -> decltype(tag_dispatch(*this, x, dest, tag, comm))
+    {
+      return tag_dispatch(*this, x, dest, tag, comm);
+    }
+
+    template<typename T>
+    requires detail::dangling_message<T>
+    request operator()(T&& x, int dest, int tag, MPI_Comm comm = MPI_COMM_WORLD) const = delete;
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var isend
+  //! @brief isend object function starting a nonblocking send of a value or a contiguous range
+  //!
+  //! **Defined in Header**
+  //!
+  //! @code
+  //! #include <mmm/p2p/isend.hpp>
+  //! @endcode
+  //!
+  //! @groupheader{Callable Signatures}
+  //!
+  //! @code
+  //! namespace mmm
+  //! {
+  //!   template<typename T>
+  //!   mmm::request isend(T const& x, int dest, int tag, MPI_Comm comm = MPI_COMM_WORLD);
+  //!
+  //!   template<typename T>
+  //!   mmm::request isend[mmm::to = dest][mmm::tag = tag][mmm::comm = comm](T const& x);
+  //! }
+  //! @endcode
+  //!
+  //! **Parameters:**
+  //!
+  //!   * `x`     : Value to send. It must not be modified until the send completes.
+  //!   * `dest`  : Rank of the destination process in `comm`.
+  //!   * `tag`   : Tag of the message.
+  //!   * `comm`  : Communicator to send the message over.
+  //!
+  //! **Options:**
+  //!
+  //!   * mmm::to                 : Rank of the destination process. Required.
+  //!   * mmm::tag                : Tag of the message. Defaults to 0.
+  //!   * mmm::comm               : Communicator to send the message over. Defaults to
+  //!                               `MPI_COMM_WORLD`.
+  //!   * mmm::cancel_on_destroy  : Cancel the send if the request is destroyed while pending.
+  //!
+  //! **Return value:**
+  //!
+  //! A mmm::request tracking the send.
+  //!
+  //! `x` can be a value which type has an associated [datatype](@ref mmm::datatype) or a
+  //! contiguous range of such values. Nested ranges are not supported. Temporaries are rejected
+  //! at compile time as they would be destroyed before the send completes, except for views like
+  //! `std::span` referring to storage owned elsewhere.
+  //!
+  //================================================================================================
+  inline constexpr tags::isend_ isend = {};
+}
+
+namespace mmm::tags
+{
+  template<detail::immediate_message T>
+  request tag_dispatch(isend_ const&, T const& x, int dest, int tag, MPI_Comm comm)
+  {
+    return detail::isend_message(x, dest, tag, comm, request::wait_on_destroy);
+  }
+
+  template<typename T>
+  requires detail::dangling_message<T>
+  request tag_dispatch(isend_ const&, T&& x, int dest, int tag, MPI_Comm comm) = delete;
+
+  template<rbr::concepts::settings Settings, detail::immediate_message T>
+  requires(decltype(Settings::contains(mmm::to))::value)
+  MMM_FORCEINLINE request tag_dispatch(isend_ const&, Settings const& s, T const& x)
+  {
+    constexpr auto p  = decltype(s[mmm::cancel_on_destroy])::value ? request::cancel_on_destroy
+                                                                    : request::wait_on_destroy;
+    return detail::isend_message( x, s[mmm::to], s[mmm::tag | 0], s[mmm::comm | MPI_COMM_WORLD]
+                                , p
+                                );
+  }
+
+  template<rbr::concepts::settings Settings, typename T>
+  requires detail::dangling_message<T>
+  request tag_dispatch(isend_ const&, Settings const& s, T&& x) = delete;
+}
@@ -0,0 +1,354 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/large_count.hpp>
+#include <mmm/system/datatype.hpp>
+#include <mmm/system/persistent.hpp>
+#include <mmm/system/request.hpp>
+#include <mmm/system/scattered.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+//==================================================================================================
+// Message protocols
+//
+// Values are classified in three kinds of messages:
+//  - single values which type has an associated datatype, sent as one element;
+//  - flat messages, i.e contiguous ranges of such values like std::vector or std::string, sent as
+//    one message straight from their storage. Receiving in a resizable container uses a matched
+//    probe to size it before receiving the message in place;
+//  - nested messages, i.e ranges of flat or nested messages like std::vector<std::string>. They
+//    are sent as two messages: a header containing the size of every container in pre-order,
+//    then the payload containing every leaf element, described by a mmm::scattered datatype so
+//    that no packing buffer is required.
+//
+// Nonblocking and persistent operations only support values and flat messages, as nested messages
+// require storage for their header and payload datatype until completion. Nonblocking and
+// persistent receives don't resize their destination.
+//
+// Without MPI-4 large count support, flat messages of at least detail::chunk_size elements are
+// sent as several chunks. Resizable receivers probe them one at a time until the shorter chunk
+// ending the transfer.
+//==================================================================================================
+namespace mmm::detail
+{
+  template<typename T>
+  concept value_message = has_datatype<std::remove_cv_t<T>> && !std::ranges::range<T>;
+
+  template<typename T>
+  concept flat_message  =   std::ranges::contiguous_range<T> && std::ranges::sized_range<T>
+                        &&  has_datatype<std::remove_cv_t<std::ranges::range_value_t<T>>>;
+
+  template<typename T>
+  concept resizable     = requires(T& t, std::size_t n) { t.resize(n); };
+
+  template<typename T> constexpr bool is_nested() noexcept
+  {
+    if      constexpr(flat_message<T>)              return true;
+    else if constexpr(std::ranges::sized_range<T>)  return is_nested<std::ranges::range_value_t<T>>();
+    else                                            return false;
+  }
+
+  template<typename T>
+  concept nested_message = !flat_message<T> && std::ranges::sized_range<T> && is_nested<T>();
+
+  template<typename T>
+  concept message = value_message<T> || flat_message<T> || nested_message<T>;
+
+  template<typename T>
+  concept immediate_message = value_message<T> || flat_message<T>;
+
+  // Temporaries are destroyed before a nonblocking or persistent operation completes, unless they
+  // only refer to storage owned elsewhere like a std::span
+  template<typename T>
+  concept dangling_message = !std::is_lvalue_reference_v<T> && !std::ranges::borrowed_range<T>;
+
+  // Type of the leaf elements of a nested message
+  template<typename T> struct leaf : leaf<std::ranges::range_value_t<T>> {};
+  template<flat_message T> struct leaf<T> { using type = std::ranges::range_value_t<T>; };
+  template<typename T> using leaf_t = typename leaf<T>::type;
+
+  // Header of a nested message: every container size in pre-order
+  using shape_t = std::vector<std::uint64_t>;
+
+  template<typename T> void shape_of(T const& x, shape_t& shape)
+  {
+    shape.push_back(static_cast<std::uint64_t>(std::ranges::size(x)));
+    if constexpr(!flat_message<T>) for(auto const& e : x) shape_of(e, shape);
+  }
+
+  template<typename T> void reshape(T& x, shape_t const& shape, std::size_t& i)
+  {
+    x.resize(static_cast<std::size_t>(shape[i++]));
+    if constexpr(!flat_message<T>) for(auto& e : x) reshape(e, shape, i);
+  }
+
+  // Address and length of every non-empty leaf of a nested message
+  template<typename T, typename P>
+  void leaves_of(T& x, std::vector<P*>& pointers, std::vector<int>& lengths)
+  {
+    if constexpr(flat_message<T>)
+    {
+      // Leaves too large for an int length are split in several blocks
+      auto p = std::ranges::data(x);
+      auto n = static_cast<std::size_t>(std::ranges::size(x));
+      for(std::size_t o = 0; o < n; o += chunk_size)
+      {
+        pointers.push_back(p + o);
+        lengths.push_back(static_cast<int>(std::min(chunk_size, n - o)));
+      }
+    }
+    else
+    {
+      for(auto& e : x) leaves_of(e, pointers, lengths);
+    }
+  }
+
+  template<typename T> auto payload_of(T& x)
+  {
+    using type = std::conditional_t<std::is_const_v<T>, leaf_t<T> const, leaf_t<T>>;
+
+    std::vector<type*>  pointers;
+    std::vector<int>    lengths;
+    leaves_of(x, pointers, lengths);
+
+    return scattered<type>(pointers, lengths);
+  }
+
+  //================================================================================================
+  // Receive a flat message of unknown size, growing the container one chunk at a time
+  //================================================================================================
+  template<typename T>
+  int recv_resized( T& x, int source, int tag, MPI_Comm comm, MPI_Status* status
+                  , [[maybe_unused]] std::size_t chunk = chunk_size
+                  )
+  {
+    auto t = mmm::datatype(mmm::type<std::ranges::range_value_t<T>>);
+
+    MPI_Message msg;
+    MPI_Status  probed;
+    if(auto e = MPI_Mprobe(source, tag, comm, &msg, &probed); e != MPI_SUCCESS) return e;
+
+#if defined(MMM_HAS_LARGE_COUNT)
+    x.resize(count_of(probed, t));
+    return mrecv(std::ranges::data(x), std::ranges::size(x), t, &msg, status);
+#else
+    // The first chunk fixes the source and tag of all the following ones
+    auto first = probed;
+
+    std::size_t total = 0;
+    for(;;)
+    {
+      auto n = count_of(probed, t);
+      x.resize(total + n);
+
+      auto e = mrecv(std::ranges::data(x) + total, n, t, &msg, MPI_STATUS_IGNORE);
+      if(e != MPI_SUCCESS) return e;
+
+      total += n;
+      if(n < chunk) break;
+
+      e = MPI_Mprobe(first.MPI_SOURCE, first.MPI_TAG, comm, &msg, &probed);
+      if(e != MPI_SUCCESS) return e;
+    }
+
+    if(status != MPI_STATUS_IGNORE)
+    {
+      *status = first;
+      MPI_Status_set_elements_x(status, t, static_cast<MPI_Count>(total));
+    }
+
+    return MPI_SUCCESS;
+#endif
+  }
+
+  //================================================================================================
+  // Send any message
+  //================================================================================================
+  template<message T>
+  int send_message(T const& x, int dest, int tag, MPI_Comm comm)
+  {
+    if constexpr(value_message<T>)
+    {
+      return MPI_Send(&x, 1, mmm::datatype(mmm::type<std::remove_cv_t<T>>), dest, tag, comm);
+    }
+    else if constexpr(flat_message<T>)
+    {
+      using type = std::remove_cv_t<std::ranges::range_value_t<T>>;
+      return send ( std::ranges::data(x), std::ranges::size(x), mmm::datatype(mmm::type<type>)
+                  , dest, tag, comm
+                  );
+    }
+    else
+    {
+      shape_t shape;
+      shape_of(x, shape);
+      if(auto e = send_message(shape, dest, tag, comm); e != MPI_SUCCESS) return e;
+
+      auto payload = payload_of(x);
+      return MPI_Send(payload.data(), 1, mmm::datatype(payload), dest, tag, comm);
+    }
+  }
+
+  //================================================================================================
+  // Receive any message
+  //================================================================================================
+  template<message T>
+  int recv_message(T& x, int source, int tag, MPI_Comm comm, MPI_Status* status)
+  {
+    if constexpr(value_message<T>)
+    {
+      return MPI_Recv(&x, 1, mmm::datatype(mmm::type<T>), source, tag, comm, status);
+    }
+    else if constexpr(flat_message<T> && resizable<T>)
+    {
+      return recv_resized(x, source, tag, comm, status);
+    }
+    else if constexpr(flat_message<T>)
+    {
+      auto t = mmm::datatype(mmm::type<std::ranges::range_value_t<T>>);
+      return recv(std::ranges::data(x), std::ranges::size(x), t, source, tag, comm, status);
+    }
+    else
+    {
+      // The header fixes the source and tag of the payload
+      shape_t     shape;
+      MPI_Status  header;
+      if(auto e = recv_message(shape, source, tag, comm, &header); e != MPI_SUCCESS) return e;
+
+      std::size_t i = 0;
+      reshape(x, shape, i);
+
+      auto payload = payload_of(x);
+      return MPI_Recv ( payload.data(), 1, mmm::datatype(payload)
+                      , header.MPI_SOURCE, header.MPI_TAG, comm, status
+                      );
+    }
+  }
+
+  //================================================================================================
+  // Start a nonblocking send or receive of a value or a flat message
+  //
+  // Persistent operations are built the same way, chunk by chunk, in a mmm::persistent.
+  // post is called once per chunk and must post a single request for it.
+  //================================================================================================
+  template<typename Ptr, typename Requests, typename Post>
+  void post_chunks( Ptr base, std::size_t count, MPI_Datatype t, Requests& r, Post post
+                  , std::size_t chunk = chunk_size
+                  )
+  {
+    auto k    = chunk_count(count, chunk);
+    auto c    = k == 1 ? count : chunk;
+    auto ext  = static_cast<std::size_t>(extent_of(t));
+
+    for(std::size_t i = 0; i < k; ++i)
+    {
+      auto o = i * c;
+      post(base + o * ext, std::min(c, count - o), &r.append());
+    }
+  }
+
+  template<immediate_message T>
+  request isend_message(T const& x, int dest, int tag, MPI_Comm comm, request::policy p)
+  {
+    request r(p);
+
+    if constexpr(value_message<T>)
+    {
+      auto t = mmm::datatype(mmm::type<std::remove_cv_t<T>>);
+      MPI_Isend(&x, 1, t, dest, tag, comm, &r.append());
+    }
+    else
+    {
+      auto t = mmm::datatype(mmm::type<std::remove_cv_t<std::ranges::range_value_t<T>>>);
+      post_chunks ( reinterpret_cast<char const*>(std::ranges::data(x)), std::ranges::size(x), t, r
+                  , [&](char const* b, std::size_t n, MPI_Request* q)
+                    {
+                      isend_chunk(b, n, t, dest, tag, comm, q);
+                    }
+                  );
+    }
+
+    return r;
+  }
+
+  template<immediate_message T>
+  request irecv_message(T& x, int source, int tag, MPI_Comm comm, request::policy p)
+  {
+    request r(p);
+
+    if constexpr(value_message<T>)
+    {
+      MPI_Irecv(&x, 1, mmm::datatype(mmm::type<T>), source, tag, comm, &r.append());
+    }
+    else
+    {
+      auto t = mmm::datatype(mmm::type<std::ranges::range_value_t<T>>);
+      post_chunks ( reinterpret_cast<char*>(std::ranges::data(x)), std::ranges::size(x), t, r
+                  , [&](char* b, std::size_t n, MPI_Request* q)
+                    {
+                      irecv_chunk(b, n, t, source, tag, comm, q);
+                    }
+                  );
+    }
+
+    return r;
+  }
+
+  template<immediate_message T>
+  persistent send_init_message(T const& x, int dest, int tag, MPI_Comm comm)
+  {
+    persistent r;
+
+    if constexpr(value_message<T>)
+    {
+      auto t = mmm::datatype(mmm::type<std::remove_cv_t<T>>);
+      MPI_Send_init(&x, 1, t, dest, tag, comm, &r.append());
+    }
+    else
+    {
+      auto t = mmm::datatype(mmm::type<std::remove_cv_t<std::ranges::range_value_t<T>>>);
+      post_chunks ( reinterpret_cast<char const*>(std::ranges::data(x)), std::ranges::size(x), t, r
+                  , [&](char const* b, std::size_t n, MPI_Request* q)
+                    {
+                      send_init(b, n, t, dest, tag, comm, q);
+                    }
+                  );
+    }
+
+    return r;
+  }
+
+  template<immediate_message T>
+  persistent recv_init_message(T& x, int source, int tag, MPI_Comm comm)
+  {
+    persistent r;
+
+    if constexpr(value_message<T>)
+    {
+      MPI_Recv_init(&x, 1, mmm::datatype(mmm::type<T>), source, tag, comm, &r.append());
+    }
+    else
+    {
+      auto t = mmm::datatype(mmm::type<std::ranges::range_value_t<T>>);
+      post_chunks ( reinterpret_cast<char*>(std::ranges::data(x)), std::ranges::size(x), t, r
+                  , [&](char* b, std::size_t n, MPI_Request* q)
+                    {
+                      recv_init(b, n, t, source, tag, comm, q);
+                    }
+                  );
+    }
+
+    return r;
+  }
+}
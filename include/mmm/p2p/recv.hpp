@@ -0,0 +1,154 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/overload.hpp>
+#include <mmm/p2p/message.hpp>
+#include <mmm/system/options.hpp>
+#include <mmm/system/soa.hpp>
+#include <mmm/system/traits.hpp>
+#include <vector>
+
+namespace mmm::tags
+{
+  struct recv_ : callable<recv_>, support_options<recv_>
+  {
+    using callable<recv_>::operator();
+    using support_options<recv_>::operator[];
+
+    template<typename T>
+    auto operator()(T& x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD) const
+    -> decltype(tag_dispatch(*this, x, source, tag, comm))
+    {
+      return tag_dispatch(*this, x, source, tag, comm);
+    }
+
+    template<typename T>
+    auto operator()(type_t<T> x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD) const
+    -> decltype(tag_dispatch(*this, x, source, tag, comm))
+    {
+      return tag_dispatch(*this, x, source, tag, comm);
+    }
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var recv
+  //! @brief recv object function performing a blocking receive of any message
+  //!
+  //! **Defined in Header**
+  //!
+  //! @code
+  //! #include <mmm/p2p/recv.hpp>
+  //! @endcode
+  //!
+  //! @groupheader{Callable Signatures}
+  //!
+  //! @code
+  //! namespace mmm
+  //! {
+  //!   template<typename T>
+  //!   MPI_Status recv(T& x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD);
+  //!
+  //!   template<typename T>
+  //!   T recv(mmm::type_t<T> target, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD);
+  //!
+  //!   template<typename T>
+  //!   MPI_Status recv[mmm::from = source][mmm::tag = tag][mmm::comm = comm](T& x);
+  //!
+  //!   template<typename T>
+  //!   T recv[mmm::from = source][mmm::tag = tag][mmm::comm = comm](mmm::type_t<T> target);
+  //! }
+  //! @endcode
+  //!
+  //! **Parameters:**
+  //!
+  //!   * `x`       : Value to receive into.
+  //!   * `target`  : A [type-to-object adapter](@ref mmm::type) instance carrying the type of
+  //!     the value to receive.
+  //!   * `source`  : Rank of the source process in `comm` or `MPI_ANY_SOURCE`.
+  //!   * `tag`     : Tag of the message or `MPI_ANY_TAG`.
+  //!   * `comm`    : Communicator to receive the message from.
+  //!
+  //! **Options:**
+  //!
+  //!   * mmm::from : Rank of the source process. Defaults to `MPI_ANY_SOURCE`.
+  //!   * mmm::tag  : Tag of the message. Defaults to `MPI_ANY_TAG`.
+  //!   * mmm::comm : Communicator to receive the message from. Defaults to `MPI_COMM_WORLD`.
+  //!
+  //! **Return value:**
+  //!
+  //! 1. The status of the receive operation. Its `MPI_ERROR` field holds the error code of the
+  //!    receive, including the ones of every message a nested container is received from.
+  //! 2. The received value. Errors are only reported through the error handler of `comm`.
+  //!
+  //! `x` can be any type supported by mmm::send. Resizable containers like `std::vector` or
+  //! `std::string`, including nested ones, are resized to fit the incoming message before it is
+  //! received in place. Other contiguous ranges like `std::span` receive as many elements as they
+  //! contain.
+  //!
+  //! `x` can also be a mmm::soa, in which case the incoming array of structures sent with the
+  //! matching [projection](@ref mmm::fields) datatype is stored as a structure of arrays.
+  //!
+  //================================================================================================
+  inline constexpr tags::recv_ recv = {};
+}
+
+namespace mmm::tags
+{
+  template<detail::message T>
+  MPI_Status tag_dispatch(recv_ const&, T& x, int source, int tag, MPI_Comm comm)
+  {
+    MPI_Status status{};
+    status.MPI_ERROR = detail::recv_message(x, source, tag, comm, &status);
+    return status;
+  }
+
+  template<detail::message T>
+  requires std::default_initializable<T>
+  T tag_dispatch(recv_ const&, type_t<T>, int source, int tag, MPI_Comm comm)
+  {
+    T x{};
+    detail::recv_message(x, source, tag, comm, MPI_STATUS_IGNORE);
+    return x;
+  }
+
+  template<rbr::concepts::settings Settings, typename T>
+  MMM_FORCEINLINE auto tag_dispatch(recv_ const& r, Settings const& s, T&& x)
+  -> decltype(r(x, 0, 0, MPI_COMM_WORLD))
+  {
+    return r( x, s[mmm::from | MPI_ANY_SOURCE], s[mmm::tag | MPI_ANY_TAG]
+            , s[mmm::comm | MPI_COMM_WORLD]
+            );
+  }
+
+  template<typename T, auto... Ms>
+  MPI_Status tag_dispatch(recv_ const&, soa<T,Ms...>& x, int source, int tag, MPI_Comm comm)
+  {
+    MPI_Status status{};
+
+    if constexpr(soa<T,Ms...>::uniform)
+    {
+      status.MPI_ERROR = MPI_Recv(x.data(), 1, mmm::datatype(x), source, tag, comm, &status);
+    }
+    else
+    {
+      // Members of different sizes can't share a datatype: receive and unpack them in one pass
+      std::vector<T> staging(x.size());
+      auto t = mmm::datatype(mmm::type<T>, mmm::fields<Ms...>);
+      status.MPI_ERROR = detail::recv(staging.data(), staging.size(), t, source, tag, comm, &status);
+      if(status.MPI_ERROR == MPI_SUCCESS)
+        detail::transpose(staging.data(), detail::count_of(status, t), x);
+    }
+
+    return status;
+  }
+}
@@ -0,0 +1,114 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/overload.hpp>
+#include <mmm/p2p/message.hpp>
+#include <mmm/system/options.hpp>
+#include <mmm/system/persistent.hpp>
+
+namespace mmm::tags
+{
+  struct recv_init_ : callable<recv_init_>, support_options<recv_init_>
+  {
+    using callable<recv_init_>::operator();
+    using support_options<recv_init_>::operator[];
+
+    template<typename T>
+    auto operator()(T& x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD) const
+    -> decltype(tag_dispatch(*this, x, source, tag, comm))
+    {
+      return tag_dispatch(*this, x, source, tag, comm);
+    }
+
+    template<typename T>
+    requires detail::dangling_message<T>
+    persistent operator()(T&& x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD) const
+    = delete;
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var recv_init
+  //! @brief recv_init object function building a persistent receive of a value or a range
+  //!
+  //! **Defined in Header**
+  //!
+  //! @code
+  //! #include <mmm/p2p/recv_init.hpp>
+  //! @endcode
+  //!
+  //! @groupheader{Callable Signatures}
+  //!
+  //! @code
+  //! namespace mmm
+  //! {
+  //!   template<typename T>
+  //!   mmm::persistent recv_init(T& x, int source, int tag, MPI_Comm comm = MPI_COMM_WORLD);
+  //!
+  //!   template<typename T>
+  //!   mmm::persistent recv_init[mmm::from = source][mmm::tag = tag][mmm::comm = comm](T& x);
+  //! }
+  //! @endcode
+  //!
+  //! **Parameters:**
+  //!
+  //!   * `x`       : Value to receive into. It must not be accessed while the receive is active.
+  //!   * `source`  : Rank of the source process in `comm` or `MPI_ANY_SOURCE`.
+  //!   * `tag`     : Tag of the message or `MPI_ANY_TAG`.
+  //!   * `comm`    : Communicator to receive the message from.
+  //!
+  //! **Options:**
+  //!
+  //!   * mmm::from : Rank of the source process. Defaults to `MPI_ANY_SOURCE`.
+  //!   * mmm::tag  : Tag of the message. Defaults to `MPI_ANY_TAG`.
+  //!   * mmm::comm : Communicator to receive the message from. Defaults to `MPI_COMM_WORLD`.
+  //!
+  //! **Return value:**
+  //!
+  //! A mmm::persistent operation receiving a message in `x` each time it is started.
+  //!
+  //! `x` can be a value which type has an associated [datatype](@ref mmm::datatype) or a
+  //! contiguous range of such values. Ranges are not resized: they receive as many elements as
+  //! they contain. The address and size of `x` are bound once: `x` must outlive the operation
+  //! and must not be reallocated. Temporaries are rejected at compile time, except for views like
+  //! `std::span` referring to storage owned elsewhere. Wildcards must not be used for messages
+  //! larger than what an `int` can count without MPI-4 support.
+  //!
+  //================================================================================================
+  inline constexpr tags::recv_init_ recv_init = {};
+}
+
+namespace mmm::tags
+{
+  template<detail::immediate_message T>
+  requires(!std::is_const_v<T>)
+  persistent tag_dispatch(recv_init_ const&, T& x, int source, int tag, MPI_Comm comm)
+  {
+    return detail::recv_init_message(x, source, tag, comm);
+  }
+
+  template<rbr::concepts::settings Settings, typename T>
+  requires(     detail::immediate_message<std::remove_cvref_t<T>>
+            &&  !std::is_const_v<std::remove_reference_t<T>>
+            &&  !detail::dangling_message<T>
+          )
+  MMM_FORCEINLINE persistent tag_dispatch(recv_init_ const&, Settings const& s, T&& x)
+  {
+    return detail::recv_init_message( x, s[mmm::from | MPI_ANY_SOURCE]
+                                    , s[mmm::tag | MPI_ANY_TAG], s[mmm::comm | MPI_COMM_WORLD]
+                                    );
+  }
+
+  template<rbr::concepts::settings Settings, typename T>
+  requires detail::dangling_message<T>
+  persistent tag_dispatch(recv_init_ const&, Settings const& s, T&& x) = delete;
+}
@@ -0,0 +1,104 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/overload.hpp>
+#include <mmm/p2p/message.hpp>
+#include <mmm/system/options.hpp>
+
+namespace mmm::tags
+{
+  struct send_ : callable<send_>, support_options<send_>
+  {
+    using callable<send_>::operator();
+    using support_options<send_>::operator[];
+
+    template<typename T>
+    auto operator()(T const& x, int dest, int tag, MPI_Comm comm = MPI_COMM_WORLD) const
+    -> decltype(tag_dispatch(*this, x, dest, tag, comm))
+    {
+      return tag_dispatch(*this, x, dest, tag, comm);
+    }
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var send
+  //! @brief send object function performing a blocking send of any message
+  //!
+  //! **Defined in Header**
+  //!
+  //! @code
+  //! #include <mmm/p2p/send.hpp>
+  //! @endcode
+  //!
+  //! @groupheader{Callable Signatures}
+  //!
+  //! @code
+  //! namespace mmm
+  //! {
+  //!   template<typename T>
+  //!   int send(T const& x, int dest, int tag, MPI_Comm comm = MPI_COMM_WORLD);
+  //!
+  //!   template<typename T>
+  //!   int send[mmm::to = dest][mmm::tag = tag][mmm::comm = comm](T const& x);
+  //! }
+  //! @endcode
+  //!
+  //! **Parameters:**
+  //!
+  //!   * `x`     : Value to send.
+  //!   * `dest`  : Rank of the destination process in `comm`.
+  //!   * `tag`   : Tag of the message.
+  //!   * `comm`  : Communicator to send the message over.
+  //!
+  //! **Options:**
+  //!
+  //!   * mmm::to   : Rank of the destination process. Required.
+  //!   * mmm::tag  : Tag of the message. Defaults to 0.
+  //!   * mmm::comm : Communicator to send the message over. Defaults to `MPI_COMM_WORLD`.
+  //!
+  //! **Return value:**
+  //!
+  //! The error code returned by MPI.
+  //!
+  //! `x` can be a value which type has an associated [datatype](@ref mmm::datatype), a contiguous
+  //! range of such values like `std::vector` or `std::string`, or any level of nested ranges of
+  //! those like `std::vector<std::string>`. Values and contiguous ranges are sent as a single
+  //! message straight from their storage. Nested ranges are sent as a header holding the size of
+  //! every range, followed by a single message describing every element in place.
+  //!
+  //! Options are resolved at compile time, so that sending a contiguous range through options
+  //! compiles down to the same single `MPI_Send` as calling it directly.
+  //!
+  //! @code
+  //! mmm::send[mmm::to = 3][mmm::tag = 7](std::span{values});
+  //! @endcode
+  //!
+  //================================================================================================
+  inline constexpr tags::send_ send = {};
+}
+
+namespace mmm::tags
+{
+  template<detail::message T>
+  int tag_dispatch(send_ const&, T const& x, int dest, int tag, MPI_Comm comm)
+  {
+    return detail::send_message(x, dest, tag, comm);
+  }
+
+  template<rbr::concepts::settings Settings, detail::message T>
+  requires(decltype(Settings::contains(mmm::to))::value)
+  MMM_FORCEINLINE int tag_dispatch(send_ const&, Settings const& s, T const& x)
+  {
+    return detail::send_message(x, s[mmm::to], s[mmm::tag | 0], s[mmm::comm | MPI_COMM_WORLD]);
+  }
+}
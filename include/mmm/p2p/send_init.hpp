@@ -0,0 +1,112 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/overload.hpp>
+#include <mmm/p2p/message.hpp>
+#include <mmm/system/options.hpp>
+#include <mmm/system/persistent.hpp>
+
+namespace mmm::tags
+{
+  struct send_init_ : callable<send_init_>, support_options<send_init_>
+  {
+    using callable<send_init_>::operator();
+    using support_options<send_init_>::operator[];
+
+    template<typename T>
+    auto operator()(T const& x, int dest, int tag, MPI_Comm comm = MPI_COMM_WORLD) const
+    -> decltype(tag_dispatch(*this, x, dest, tag, comm))
+    {
+      return tag_dispatch(*this, x, dest, tag, comm);
+    }
+
+    template<typename T>
+    requires detail::dangling_message<T>
+    persistent operator()(T&& x, int dest, int tag, MPI_Comm comm = MPI_COMM_WORLD) const = delete;
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var send_init
+  //! @brief send_init object function building a persistent send of a value or a range
+  //!
+  //! **Defined in Header**
+  //!
+  //! @code
+  //! #include <mmm/p2p/send_init.hpp>
+  //! @endcode
+  //!
+  //! @groupheader{Callable Signatures}
+  //!
+  //! @code
+  //! namespace mmm
+  //! {
+  //!   template<typename T>
+  //!   mmm::persistent send_init(T const& x, int dest, int tag, MPI_Comm comm = MPI_COMM_WORLD);
+  //!
+  //!   template<typename T>
+  //!   mmm::persistent send_init[mmm::to = dest][mmm::tag = tag][mmm::comm = comm](T const& x);
+  //! }
+  //! @endcode
+  //!
+  //! **Parameters:**
+  //!
+  //!   * `x`     : Value to send. It must not be modified while the send is active.
+  //!   * `dest`  : Rank of the destination process in `comm`.
+  //!   * `tag`   : Tag of the message.
+  //!   * `comm`  : Communicator to send the message over.
+  //!
+  //! **Options:**
+  //!
+  //!   * mmm::to   : Rank of the destination process. Required.
+  //!   * mmm::tag  : Tag of the message. Defaults to 0.
+  //!   * mmm::comm : Communicator to send the message over. Defaults to `MPI_COMM_WORLD`.
+  //!
+  //! **Return value:**
+  //!
+  //! A mmm::persistent operation sending the current content of `x` each time it is started.
+  //!
+  //! `x` can be a value which type has an associated [datatype](@ref mmm::datatype) or a
+  //! contiguous range of such values. Nested ranges are not supported. The address and size of
+  //! `x` are bound once: `x` must outlive the operation and must not be reallocated. Temporaries
+  //! are rejected at compile time, except for views like `std::span` referring to storage owned
+  //! elsewhere.
+  //!
+  //================================================================================================
+  inline constexpr tags::send_init_ send_init = {};
+}
+
+namespace mmm::tags
+{
+  template<detail::immediate_message T>
+  persistent tag_dispatch(send_init_ const&, T const& x, int dest, int tag, MPI_Comm comm)
+  {
+    return detail::send_init_message(x, dest, tag, comm);
+  }
+
+  template<typename T>
+  requires detail::dangling_message<T>
+  persistent tag_dispatch(send_init_ const&, T&& x, int dest, int tag, MPI_Comm comm) = delete;
+
+  template<rbr::concepts::settings Settings, detail::immediate_message T>
+  requires(decltype(Settings::contains(mmm::to))::value)
+  MMM_FORCEINLINE persistent tag_dispatch(send_init_ const&, Settings const& s, T const& x)
+  {
+    return detail::send_init_message( x, s[mmm::to], s[mmm::tag | 0]
+                                    , s[mmm::comm | MPI_COMM_WORLD]
+                                    );
+  }
+
+  template<rbr::concepts::settings Settings, typename T>
+  requires detail::dangling_message<T>
+  persistent tag_dispatch(send_init_ const&, Settings const& s, T&& x) = delete;
+}
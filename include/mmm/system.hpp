@@ -7,5 +7,23 @@
 //==================================================================================================
 #pragma once
 
+#include <mmm/system/barrier.hpp>
+#include <mmm/system/cartesian.hpp>
+#include <mmm/system/communicator.hpp>
+#include <mmm/system/completion.hpp>
 #include <mmm/system/context.hpp>
 #include <mmm/system/datatype.hpp>
+#include <mmm/system/fields.hpp>
+#include <mmm/system/graph.hpp>
+#include <mmm/system/half.hpp>
+#include <mmm/system/indexed.hpp>
+#include <mmm/system/op.hpp>
+#include <mmm/system/options.hpp>
+#include <mmm/system/packer.hpp>
+#include <mmm/system/persistent.hpp>
+#include <mmm/system/reduction.hpp>
+#include <mmm/system/request.hpp>
+#include <mmm/system/scattered.hpp>
+#include <mmm/system/session.hpp>
+#include <mmm/system/soa.hpp>
+#include <mmm/system/view.hpp>
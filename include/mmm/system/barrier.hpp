@@ -0,0 +1,60 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/system/communicator.hpp>
+#include <mmm/system/request.hpp>
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct fuzzy_barrier
+  //! @brief Split-phase barrier over a communicator
+  //!
+  //! mmm::fuzzy_barrier separates a barrier in two phases: arrive() signals that the current
+  //! process reached the barrier and wait() blocks until all processes of the communicator did.
+  //! Work that does not depend on other processes can be performed between both calls.
+  //!
+  //! A barrier can be reused once the previous phase is complete.
+  //!
+  //! @code
+  //! mmm::fuzzy_barrier step(ctx.world());
+  //!
+  //! for(int i = 0; i < n; ++i)
+  //! {
+  //!   update_boundaries();
+  //!   step.arrive();
+  //!   update_interior();
+  //!   step.wait();
+  //! }
+  //! @endcode
+  //================================================================================================
+  struct fuzzy_barrier
+  {
+    //! @brief Build a barrier over a communicator
+    //! @param comm Communicator to synchronize. It must outlive the barrier.
+    explicit fuzzy_barrier(communicator const& comm) noexcept : comm_(&comm) {}
+
+    //! Signal that current process reached the barrier
+    void arrive() { pending_ = comm_->synchronize_async(); }
+
+    //! Did all processes reach the barrier ? Never blocks.
+    bool ready() { return !pending_ || pending_.test(); }
+
+    //! Block until all processes reached the barrier
+    void wait() { if(pending_) pending_.wait(); }
+
+    //! Is the current process between arrive() and completion of the barrier ?
+    bool pending() const noexcept { return pending_.active(); }
+
+    private:
+    communicator const* comm_;
+    request             pending_;
+  };
+}
@@ -0,0 +1,233 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/system/communicator.hpp>
+#include <mmm/system/datatype.hpp>
+#include <mmm/system/view.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace mmm::detail
+{
+  // Number of neighbors directions, including the current process, in a N-dimensional grid
+  template<std::size_t N> inline constexpr std::size_t directions = 3 * directions<N-1>;
+  template<>              inline constexpr std::size_t directions<0> = 1;
+
+  // Direction index of an offset in {-1,0,1}^N, the first dimension being the slowest one
+  template<std::size_t N>
+  constexpr std::size_t direction_of(std::array<int,N> const& offset) noexcept
+  {
+    std::size_t i = 0;
+    for(auto o : offset) i = 3*i + static_cast<std::size_t>(o + 1);
+    return i;
+  }
+
+  template<std::size_t N>
+  constexpr std::array<int,N> direction_offset(std::size_t direction) noexcept
+  {
+    std::array<int,N> offset{};
+    for(std::size_t i = N; i-- > 0; direction /= 3) offset[i] = static_cast<int>(direction % 3) - 1;
+    return offset;
+  }
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct cartesian
+  //! @brief Communicator with a N-dimensional Cartesian topology
+  //!
+  //! mmm::cartesian distributes the processes of a communicator over a N-dimensional grid built
+  //! by `MPI_Dims_create` and `MPI_Cart_create`. Ranks are reordered by default so that the MPI
+  //! library can map neighboring processes of the grid onto nearby cores and nodes.
+  //!
+  //! The rank of all the 3^N-1 neighbors of the current process, along faces, edges and corners,
+  //! are computed once on construction. Neighbors outside of a non-periodic grid are
+  //! `MPI_PROC_NULL`, so that communications with them complete immediately.
+  //!
+  //! @code
+  //! mmm::cartesian<3> grid(ctx.world(), {0,0,0}, {true,true,true});
+  //! auto east = grid.neighbor({0,0,1});
+  //! @endcode
+  //!
+  //! @tparam N Number of dimensions of the grid
+  //================================================================================================
+  template<std::size_t N>
+  struct cartesian
+  {
+    static_assert(N > 0, "[MMM] - mmm::cartesian must have at least one dimension");
+
+    //! Type of the grid dimensions and coordinates
+    using shape_type = std::array<int,N>;
+
+    //! @brief Build a Cartesian communicator
+    //! This operation is collective over all processes of `base`. Processes not fitting in the
+    //! grid get a null communicator.
+    //! @param base     Communicator containing the processes to distribute
+    //! @param dims     Number of processes along each dimension. Zeros are computed so that the
+    //!                 grid is as balanced as possible.
+    //! @param periods  Is the grid periodic along each dimension ?
+    //! @param reorder  Can the MPI library reorder the ranks of the processes ?
+    cartesian ( communicator const& base, shape_type dims = {}
+              , std::array<bool,N> const& periods = {}, bool reorder = true
+              )
+            : dims_(dims), periods_{}, coords_{}
+    {
+      for(std::size_t i = 0; i < N; ++i) periods_[i] = periods[i] ? 1 : 0;
+
+      // Fully specified grids may be smaller than base, which MPI_Dims_create rejects
+      if(std::ranges::find(dims_, 0) != dims_.end())
+        MPI_Dims_create(base.size(), static_cast<int>(N), dims_.data());
+
+      MPI_Comm that;
+      MPI_Cart_create ( base.handle(), static_cast<int>(N), dims_.data(), periods_.data()
+                      , reorder ? 1 : 0, &that
+                      );
+      comm_ = communicator(that);
+
+      neighbors_.fill(MPI_PROC_NULL);
+      if(!comm_) return;
+
+      MPI_Cart_coords(comm_.handle(), comm_.rank(), static_cast<int>(N), coords_.data());
+      for(std::size_t d = 0; d < neighbors_.size(); ++d) neighbors_[d] = locate(d);
+    }
+
+    //! Underlying communicator
+    communicator const& comm()    const noexcept { return comm_; }
+    //! Number of processes in the grid
+    int                 size()    const noexcept { return comm_.size(); }
+    //! Rank of current process in the grid
+    int                 rank()    const noexcept { return comm_.rank(); }
+    //! Number of processes along each dimension
+    shape_type const&   dims()    const noexcept { return dims_; }
+    //! Coordinates of the current process in the grid
+    shape_type const&   coords()  const noexcept { return coords_; }
+    //! Is the grid periodic along a given dimension ?
+    bool periodic(std::size_t i)  const noexcept { return periods_[i] != 0; }
+
+    //! Synchronize all processes of the grid
+    void synchronize() const { comm_.synchronize(); }
+
+    //! @brief Rank of a neighbor of the current process
+    //! @param offset Position of the neighbor relative to current process, in {-1,0,1}^N
+    //! @return The rank of the neighbor or `MPI_PROC_NULL` if it is outside of the grid
+    int neighbor(shape_type const& offset) const noexcept
+    {
+      return neighbors_[detail::direction_of(offset)];
+    }
+
+    private:
+    int locate(std::size_t direction) const noexcept
+    {
+      auto c = detail::direction_offset<N>(direction);
+      for(std::size_t i = 0; i < N; ++i)
+      {
+        c[i] += coords_[i];
+        if(c[i] >= 0 && c[i] < dims_[i]) continue;
+        if(!periods_[i]) return MPI_PROC_NULL;
+        c[i] = (c[i] + dims_[i]) % dims_[i];
+      }
+
+      int r;
+      MPI_Cart_rank(comm_.handle(), c.data(), &r);
+      return r;
+    }
+
+    communicator                                  comm_;
+    shape_type                                    dims_;
+    shape_type                                    periods_;
+    shape_type                                    coords_;
+    std::array<int, detail::directions<N>>        neighbors_;
+  };
+
+  //================================================================================================
+  //! @brief Exchange the halo of a block distributed over a Cartesian grid
+  //!
+  //! `local` covers the block owned by the current process and its halo of `width` elements on
+  //! each side. The outer layers of the owned part are sent to the 3^N-1 neighbors along faces,
+  //! edges and corners, while the halo is filled by theirs. All sends and receives are posted at
+  //! once using the cached strided datatypes of each region, then completed together.
+  //!
+  //! Dimension `i` of `local` is distributed along dimension `i` of the grid. Halo regions facing
+  //! the border of a non-periodic grid are left untouched. Processes left out of the grid don't
+  //! take part in the exchange.
+  //!
+  //! @code
+  //! std::vector<double> u((nx+2)*(ny+2)*(nz+2));
+  //! mmm::halo_exchange(grid, mmm::view(u.data(), {nx+2, ny+2, nz+2}));
+  //! @endcode
+  //!
+  //! @param grid   Cartesian communicator distributing the blocks
+  //! @param local  View over the local block, halo included
+  //! @param width  Number of halo elements on each side of each dimension
+  //! @return `MPI_ERR_ARG` if `width` is negative or if an extent of `local` is smaller than
+  //!         `3*width`, so that sent regions never overlap ghost regions, the result of the
+  //!         completion of all transfers otherwise.
+  //================================================================================================
+  template<typename T, std::size_t N>
+  requires detail::has_datatype<std::remove_cv_t<T>>
+  int halo_exchange(cartesian<N> const& grid, view<T,N> const& local, std::ptrdiff_t width = 1)
+  {
+    using shape_type = typename view<T,N>::shape_type;
+    constexpr auto count = detail::directions<N>;
+    constexpr auto self  = count / 2;
+
+    if(width < 0) return MPI_ERR_ARG;
+    for(auto e : local.extents()) if(e < 3*width) return MPI_ERR_ARG;
+    if(!grid.comm() || width == 0) return MPI_SUCCESS;
+
+    std::array<MPI_Request, 2*(count-1)> requests;
+    std::size_t k = 0;
+
+    // Region of the local block selected along each dimension by a direction
+    auto region = [&](std::size_t d, bool ghost)
+    {
+      auto offset = detail::direction_offset<N>(d);
+      shape_type start, extent;
+
+      for(std::size_t i = 0; i < N; ++i)
+      {
+        auto e = local.extents()[i];
+        switch(offset[i])
+        {
+          case -1 : start[i] = ghost ? 0 : width;             extent[i] = width;        break;
+          case  1 : start[i] = e - (ghost ? width : 2*width); extent[i] = width;        break;
+          default : start[i] = width;                         extent[i] = e - 2*width;  break;
+        }
+      }
+
+      return local.subview(start, extent);
+    };
+
+    for(std::size_t d = 0; d < count; ++d)
+    {
+      if(d == self) continue;
+
+      // Data coming from the neighbor in direction d was sent by it in the opposite direction
+      auto ghost = region(d, true);
+      MPI_Irecv ( ghost.data(), 1, mmm::datatype(ghost), grid.neighbor(detail::direction_offset<N>(d))
+                , static_cast<int>(count - 1 - d), grid.comm().handle(), &requests[k++]
+                );
+    }
+
+    for(std::size_t d = 0; d < count; ++d)
+    {
+      if(d == self) continue;
+
+      auto inner = region(d, false);
+      MPI_Isend ( inner.data(), 1, mmm::datatype(inner), grid.neighbor(detail::direction_offset<N>(d))
+                , static_cast<int>(d), grid.comm().handle(), &requests[k++]
+                );
+    }
+
+    return MPI_Waitall(static_cast<int>(k), requests.data(), MPI_STATUSES_IGNORE);
+  }
+}
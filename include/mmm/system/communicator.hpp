@@ -0,0 +1,141 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/system/request.hpp>
+#include <utility>
+
+namespace mmm
+{
+  //! Class enumeration for communicator splitting by type
+  enum comm_type
+  {
+    //! Processes that can create a shared memory region
+    shared = MPI_COMM_TYPE_SHARED
+  };
+
+  //================================================================================================
+  //! @struct communicator
+  //! @brief RAII-enabled MPI communicator
+  //!
+  //! mmm::communicator wraps a `MPI_Comm` and frees it when destroyed. Its size and the rank of
+  //! the current process are queried once on construction and cached, so that hot paths never
+  //! call `MPI_Comm_size` or `MPI_Comm_rank`.
+  //!
+  //! mmm::communicator is move-only. Predefined communicators like `MPI_COMM_WORLD` can be wrapped
+  //! but are never freed.
+  //!
+  //! @code
+  //! mmm::communicator world(MPI_COMM_WORLD);
+  //! auto library  = world.dup();
+  //! auto rows     = world.split(world.rank() / 4);
+  //! auto node     = world.split_type(mmm::shared);
+  //! @endcode
+  //================================================================================================
+  struct communicator
+  {
+    //! Build a null communicator
+    communicator() noexcept : comm_(MPI_COMM_NULL), size_(0), rank_(MPI_UNDEFINED) {}
+
+    //! @brief Take ownership of a `MPI_Comm`
+    //! @param comm Communicator to wrap. Predefined communicators are not freed.
+    explicit communicator(MPI_Comm comm) noexcept : comm_(comm), size_(0), rank_(MPI_UNDEFINED)
+    {
+      if(comm_ != MPI_COMM_NULL)
+      {
+        MPI_Comm_size(comm_, &size_);
+        MPI_Comm_rank(comm_, &rank_);
+      }
+    }
+
+    //! Release the communicator
+    ~communicator() { release(); }
+
+    communicator(communicator const&)             = delete;
+    communicator& operator=(communicator const&)  = delete;
+
+    communicator(communicator&& other) noexcept
+      : comm_(std::exchange(other.comm_, MPI_COMM_NULL))
+      , size_(std::exchange(other.size_, 0))
+      , rank_(std::exchange(other.rank_, MPI_UNDEFINED))
+    {}
+
+    communicator& operator=(communicator&& other) noexcept
+    {
+      communicator local(std::move(other));
+      std::swap(comm_, local.comm_);
+      std::swap(size_, local.size_);
+      std::swap(rank_, local.rank_);
+      return *this;
+    }
+
+    //! Number of processes in the communicator
+    int       size()    const noexcept { return size_; }
+    //! Rank of current process in the communicator or `MPI_UNDEFINED` for a null communicator
+    int       rank()    const noexcept { return rank_; }
+    //! Underlying `MPI_Comm` handle
+    MPI_Comm  handle()  const noexcept { return comm_; }
+
+    //! Is the communicator not null ?
+    explicit operator bool() const noexcept { return comm_ != MPI_COMM_NULL; }
+
+    //! Synchronize all processes of the communicator
+    void synchronize() const { MPI_Barrier(comm_); }
+
+    //! Start synchronizing all processes of the communicator and returns the pending barrier
+    request synchronize_async() const
+    {
+      MPI_Request r;
+      MPI_Ibarrier(comm_, &r);
+      return request(r);
+    }
+
+    //! Build a communicator with the same processes and an isolated communication space
+    communicator dup() const
+    {
+      MPI_Comm that;
+      MPI_Comm_dup(comm_, &that);
+      return communicator(that);
+    }
+
+    //! @brief Build communicators from processes sharing the same color
+    //! @param color  Color of current process or `MPI_UNDEFINED` to get a null communicator
+    //! @param key    Key ordering the ranks in the new communicator
+    communicator split(int color, int key = 0) const
+    {
+      MPI_Comm that;
+      MPI_Comm_split(comm_, color, key, &that);
+      return communicator(that);
+    }
+
+    //! @brief Build communicators from processes sharing a resource
+    //! @param type   [Kind of resource](@ref comm_type) shared by the processes
+    //! @param key    Key ordering the ranks in the new communicator
+    communicator split_type(comm_type type, int key = 0) const
+    {
+      MPI_Comm that;
+      MPI_Comm_split_type(comm_, static_cast<int>(type), key, MPI_INFO_NULL, &that);
+      return communicator(that);
+    }
+
+    private:
+    void release() noexcept
+    {
+      if(comm_ == MPI_COMM_NULL || comm_ == MPI_COMM_WORLD || comm_ == MPI_COMM_SELF) return;
+
+      int done;
+      MPI_Finalized(&done);
+      if(!done) MPI_Comm_free(&comm_);
+    }
+
+    MPI_Comm  comm_;
+    int       size_;
+    int       rank_;
+  };
+}
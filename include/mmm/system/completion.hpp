@@ -0,0 +1,257 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/kumi.hpp>
+#include <mmm/system/request.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//==================================================================================================
+// Completion of several requests
+//
+// Any type tracking a pending operation, like mmm::request, mmm::neighbor_request or
+// mmm::persistent, can be completed along others. The handles of every message of each operation
+// are gathered for a single MPI call, then written back so that requests know they completed.
+// Handles of a given operation are stored contiguously so that the index of a completed handle
+// maps back to its operation. Storage stays on the stack unless operations are split in more
+// messages than there are operations.
+//==================================================================================================
+namespace mmm::detail
+{
+  template<typename T>
+  concept completable = requires(T& r)
+  {
+    r.for_each([](MPI_Request&) {});
+    r.wait();
+    r.test();
+  };
+
+  template<typename Requests>
+  concept completable_tuple = kumi::product_type<std::remove_cvref_t<Requests>>;
+
+  // Contiguous storage for elements of each handle, on the stack if there are at most N of them
+  template<typename T, std::size_t N> struct handle_buffer
+  {
+    explicit handle_buffer(std::size_t count) : heap_(count > N ? count : 0) {}
+
+    T*  data()                    noexcept { return heap_.empty() ? local_.data() : heap_.data(); }
+    T&  operator[](std::size_t i) noexcept { return data()[i]; }
+
+    std::array<T, N>  local_;
+    std::vector<T>    heap_;
+  };
+
+  // Handles of every message of N operations, those of the i-th one in [offsets[i], offsets[i+1])
+  template<std::size_t N> struct handle_set
+  {
+    std::array<std::size_t, N + 1>  offsets;
+    handle_buffer<MPI_Request, N>   handles;
+
+    std::size_t size()              const noexcept { return offsets[N]; }
+    std::size_t size(std::size_t i) const noexcept { return offsets[i + 1] - offsets[i]; }
+
+    // Index of the operation owning the i-th handle
+    std::size_t owner(std::size_t i) const noexcept
+    {
+      auto o = std::upper_bound(offsets.begin(), offsets.end(), i);
+      return static_cast<std::size_t>(o - offsets.begin()) - 1;
+    }
+  };
+
+  template<std::size_t N, typename Requests>
+  std::array<std::size_t, N + 1> count_handles(Requests& rs) noexcept
+  {
+    std::array<std::size_t, N + 1> offsets = {};
+    kumi::for_each_index( [&](auto i, auto& r)
+                          {
+                            r.for_each([&](MPI_Request&) { ++offsets[i + 1]; });
+                          }
+                        , rs
+                        );
+
+    for(std::size_t i = 0; i < N; ++i) offsets[i + 1] += offsets[i];
+    return offsets;
+  }
+
+  template<typename Requests>
+  auto gather_handles(Requests& rs)
+  {
+    constexpr auto n = kumi::size_v<Requests>;
+
+    auto offsets = count_handles<n>(rs);
+    handle_set<n> set{offsets, handle_buffer<MPI_Request, n>(offsets[n])};
+
+    kumi::for_each_index( [&](auto i, auto& r)
+                          {
+                            auto k = set.offsets[i];
+                            r.for_each([&](MPI_Request& h) { set.handles[k++] = h; });
+                          }
+                        , rs
+                        );
+    return set;
+  }
+
+  template<typename Requests, typename Handles>
+  void scatter_handles(Requests& rs, Handles& set) noexcept
+  {
+    kumi::for_each_index( [&](auto i, auto& r)
+                          {
+                            auto k = set.offsets[i];
+                            r.for_each([&](MPI_Request& h) { h = set.handles[k++]; });
+                          }
+                        , rs
+                        );
+  }
+
+  // Status of an operation without any message
+  inline MPI_Status empty_status() noexcept
+  {
+    MPI_Status status;
+    status.MPI_SOURCE = MPI_ANY_SOURCE;
+    status.MPI_TAG    = MPI_ANY_TAG;
+    status.MPI_ERROR  = MPI_SUCCESS;
+    return status;
+  }
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @brief Wait for the completion of several requests
+  //!
+  //! All requests are completed by a single call to `MPI_Waitall`.
+  //!
+  //! @code
+  //! auto statuses = mmm::wait_all(kumi::tie(send_values, recv_indexes, gather));
+  //! @endcode
+  //!
+  //! @param rs A kumi::tuple of requests or references to requests
+  //! @return A std::array containing the status of each request
+  //================================================================================================
+  template<detail::completable_tuple Requests>
+  auto wait_all(Requests&& rs)
+  {
+    constexpr auto n = kumi::size_v<Requests>;
+
+    auto set = detail::gather_handles(rs);
+    detail::handle_buffer<MPI_Status, n> all(set.size());
+    MPI_Waitall(static_cast<int>(set.size()), set.handles.data(), all.data());
+    detail::scatter_handles(rs, set);
+
+    // Each operation reports the status of its first message
+    std::array<MPI_Status, n> status;
+    for(std::size_t i = 0; i < n; ++i)
+      status[i] = set.size(i) ? all[set.offsets[i]] : detail::empty_status();
+
+    return status;
+  }
+
+  //! @overload
+  template<detail::completable... Requests>
+  requires(sizeof...(Requests) > 0)
+  auto wait_all(Requests&... rs) { return wait_all(kumi::tie(rs...)); }
+
+  //================================================================================================
+  //! @brief Wait for the completion of any request
+  //!
+  //! @param rs A kumi::tuple of requests or references to requests
+  //! @return A std::pair containing the index of the completed request and its status. If no
+  //!         request was active, the index is the number of requests.
+  //================================================================================================
+  template<detail::completable_tuple Requests>
+  std::pair<std::size_t, MPI_Status> wait_any(Requests&& rs)
+  {
+    constexpr auto n = kumi::size_v<Requests>;
+
+    auto set = detail::gather_handles(rs);
+    int index;
+    MPI_Status status;
+    MPI_Waitany(static_cast<int>(set.size()), set.handles.data(), &index, &status);
+
+    if(index == MPI_UNDEFINED)
+    {
+      detail::scatter_handles(rs, set);
+      return {n, status};
+    }
+
+    // Other messages of the operation are parts of the same transfer and are waited for as well
+    auto i = set.owner(static_cast<std::size_t>(index));
+    MPI_Waitall ( static_cast<int>(set.size(i)), set.handles.data() + set.offsets[i]
+                , MPI_STATUSES_IGNORE
+                );
+    detail::scatter_handles(rs, set);
+
+    return {i, status};
+  }
+
+  //! @overload
+  template<detail::completable... Requests>
+  requires(sizeof...(Requests) > 0)
+  auto wait_any(Requests&... rs) { return wait_any(kumi::tie(rs...)); }
+
+  //================================================================================================
+  //! @brief Check for the completion of several requests without blocking
+  //!
+  //! All requests are tested by a single call to `MPI_Testsome`.
+  //!
+  //! @param rs A kumi::tuple of requests or references to requests
+  //! @return A std::array containing, for each request, its status if it completed during this
+  //!         call or an empty std::optional otherwise.
+  //================================================================================================
+  template<detail::completable_tuple Requests>
+  auto test_some(Requests&& rs)
+  {
+    constexpr auto n = kumi::size_v<Requests>;
+
+    auto set = detail::gather_handles(rs);
+    detail::handle_buffer<int, n>         indexes(set.size());
+    detail::handle_buffer<MPI_Status, n>  status(set.size());
+    int count;
+    MPI_Testsome( static_cast<int>(set.size()), set.handles.data()
+                , &count, indexes.data(), status.data()
+                );
+
+    // Operations report the status of their first message if it completed during this call
+    std::array<std::optional<MPI_Status>, n> completed;
+    if(count == MPI_UNDEFINED) count = 0;
+
+    for(std::size_t k = 0; k < static_cast<std::size_t>(count); ++k)
+    {
+      auto h = static_cast<std::size_t>(indexes[k]);
+      auto i = set.owner(h);
+      if(!completed[i] || h == set.offsets[i]) completed[i] = status[k];
+    }
+
+    // Operations made of several messages complete once all of them did
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      if(!completed[i] || set.size(i) < 2) continue;
+
+      int done;
+      MPI_Testall ( static_cast<int>(set.size(i)), set.handles.data() + set.offsets[i], &done
+                  , MPI_STATUSES_IGNORE
+                  );
+      if(!done) completed[i].reset();
+    }
+
+    detail::scatter_handles(rs, set);
+    return completed;
+  }
+
+  //! @overload
+  template<detail::completable... Requests>
+  requires(sizeof...(Requests) > 0)
+  auto test_some(Requests&... rs) { return test_some(kumi::tie(rs...)); }
+}
@@ -8,7 +8,14 @@
 #pragma once
 
 #include <mpi.h>
+#include <mmm/detail/registry.hpp>
+#include <mmm/system/communicator.hpp>
+#include <mmm/system/options.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <ostream>
 
 namespace mmm
@@ -42,6 +49,34 @@ namespace mmm
   //! mmm::context encapsulates all the MPI setup and teardown process in a RAII enabled
   //! type. It also provides access to persistent informations about the MPI environment like
   //! size, rank and node ID.
+  //!
+  //! The derived datatypes built by mmm::datatype while a context is alive are registered in it
+  //! and released when it is destroyed, before MPI is finalized.
+  //!
+  //! Processes are also grouped by node: a node-local communicator gathers the processes able to
+  //! share memory and a leaders communicator gathers the first process of each node, so that
+  //! shared-memory and hierarchical algorithms can be built on top of them.
+  //!
+  //! Startup cost can be reduced by passing options to the constructor:
+  //!
+  //!   * mmm::lazy : The node ID and the node topology are not queried on construction. The
+  //!     related members keep their default value until one of the `query_` member functions,
+  //!     mmm::context::node or mmm::context::leaders is called. As discovering the node topology
+  //!     is a collective operation, all processes must then query it at the same point of the
+  //!     program.
+  //!   * mmm::background : `MPI_Init_thread` runs on a helper thread so that application setup
+  //!     can proceed in the meantime. mmm::context::wait must be called before using MPI. The
+  //!     helper thread is kept until the context is destroyed so that `MPI_Finalize` is called
+  //!     from the thread which initialized MPI. As other threads will perform MPI calls, at least
+  //!     mmm::serialized thread support is requested and mmm::context::wait throws if the
+  //!     library provides less.
+  //!
+  //! @code
+  //! mmm::context ctx(argc, argv, mmm::multiple, mmm::background, mmm::lazy);
+  //! load_mesh();
+  //! ctx.wait();
+  //! auto local = ctx.query_node_rank();
+  //! @endcode
   //================================================================================================
   struct context
   {
@@ -60,10 +95,11 @@ namespace mmm
     //! @brief Constructor with thread support
     //! Initialize the MPI environment at a given thread support level and gather informations
     //! @param ts   Expected [thread support level](@ref thread_support)
-    context(thread_support ts)
+    //! @param opts Initialization options
+    template<rbr::concepts::option... Options>
+    context(thread_support ts, Options const&... opts) : context(uninitialized{})
     {
-      init_thread(nullptr, nullptr, ts);
-      prepare();
+      start(nullptr, nullptr, ts, opts...);
     }
 
     //! @brief Constructor from argc/argv with thread support
@@ -71,35 +107,163 @@ namespace mmm
     //! @param argc `argc` Number of command line argument
     //! @param argv `argv` array of command line argument's strings
     //! @param ts   Expected [thread support level](@ref thread_support)
-    context(int& argc, char**& argv, thread_support ts)
+    //! @param opts Initialization options
+    template<rbr::concepts::option... Options>
+    context(int& argc, char**& argv, thread_support ts, Options const&... opts)
+      : context(uninitialized{})
     {
-      init_thread(&argc, &argv, ts);
-      prepare();
+      start(&argc, &argv, ts, opts...);
     }
 
     //! @brief Destructor
-    //! Teardown the MPI environment by calling `MPI_Finalize()`.
-    ~context() { MPI_Finalize(); }
+    //! Release all derived datatypes and operations built by MMM and teardown the MPI environment
+    //! by calling `MPI_Finalize()`.
+    ~context()
+    {
+      if(prepared_)
+      {
+        detail::detach(types_);
+        types_.release();
+
+        leaders_  = communicator{};
+        node_     = communicator{};
+      }
+
+      if(init_.joinable())
+      {
+        // MPI_Finalize runs on the thread that called MPI_Init_thread
+        {
+          std::lock_guard lock(state_);
+          finalizing_ = true;
+        }
+        signal_.notify_all();
+        init_.join();
+      }
+      else
+      {
+        MPI_Finalize();
+      }
+    }
 
     // mmm::context is non-copyable
     context(context const&)             =delete;
     context& operator=(context const&)  =delete;
 
+    //! @brief Complete a background initialization. Does nothing otherwise.
+    //! Throws `std::runtime_error` if the MPI library doesn't provide at least mmm::serialized
+    //! thread support, as MPI can't be used by other threads than the helper one in this case.
+    void wait()
+    {
+      if(prepared_ || !init_.joinable()) return;
+
+      {
+        std::unique_lock lock(state_);
+        signal_.wait(lock, [&]() { return initialized_; });
+      }
+
+      if(thread_level < thread_support::serialized)
+      {
+        throw std::runtime_error( "[MMM] - Background initialization requires at least serialized"
+                                  " thread support"
+                                );
+      }
+
+      prepare();
+    }
+
     //! Synchronize current context
-    void synchronize() const { MPI_Barrier(MPI_COMM_WORLD); }
+    void synchronize() const { world_.synchronize(); }
+
+    //! Start synchronizing current context and returns the pending barrier
+    request synchronize_async() const { return world_.synchronize_async(); }
+
+    //! Communicator containing all processes of the current MPI environment
+    communicator const& world() const noexcept { return world_; }
+
+    //! Communicator containing all processes of the current node
+    communicator const& node()    { load_nodes(); return node_; }
+    //! Communicator containing the first process of each node, null on other processes
+    communicator const& leaders() { load_nodes(); return leaders_; }
+
+    //! Node ID for current process, querying it first if required
+    std::string const& query_node_id()    { load_name();  return node_id;     }
+    //! Rank of current process in its node, querying the node topology first if required
+    int                query_node_rank()  { load_nodes(); return node_rank;   }
+    //! Number of processes in the node, querying the node topology first if required
+    int                query_node_size()  { load_nodes(); return node_size;   }
+    //! Number of nodes, querying the node topology first if required
+    int                query_node_count() { load_nodes(); return node_count;  }
+    //! Index of the node of current process, querying the node topology first if required
+    int                query_node_index() { load_nodes(); return node_index;  }
 
     //! Size of current MPI environment
     int         size;
     //! Rank of current process in the current MPI environment
     int         rank;
-    //! Node ID for current process
+    //! Node ID for current process, empty until queried if the context is lazy
     std::string node_id;
+    //! Rank of current process in its node, 0 until queried if the context is lazy
+    int         node_rank;
+    //! Number of processes in the node of current process, 0 until queried if the context is lazy
+    int         node_size;
+    //! Number of nodes in the current MPI environment, 0 until queried if the context is lazy
+    int         node_count;
+    //! Index of the node of current process among all nodes, 0 until queried if the context is lazy
+    int         node_index;
 
     //! Provided thread support
     thread_support thread_level;
 
     // Internal helpers
     private:
+    struct uninitialized {};
+    context(uninitialized)
+      : size{}, rank{}, node_rank{}, node_size{}, node_count{}, node_index{}, thread_level{}
+      , lazy_{}, prepared_{}, initialized_{}, finalizing_{}
+    {}
+
+    detail::registry        types_;
+    communicator            world_;
+    communicator            node_;
+    communicator            leaders_;
+    std::thread             init_;
+    std::mutex              state_;
+    std::condition_variable signal_;
+    std::once_flag          name_loaded_, nodes_loaded_;
+    bool                    lazy_, prepared_, initialized_, finalizing_;
+
+    template<typename... Options>
+    void start(int* argc, char*** argv, thread_support ts, Options const&... opts)
+    {
+      using settings = decltype(rbr::settings(opts...));
+      lazy_ = decltype(std::declval<settings>()[mmm::lazy])::value;
+
+      if constexpr(decltype(std::declval<settings>()[mmm::background])::value)
+      {
+        auto level = ts < thread_support::serialized ? thread_support::serialized : ts;
+        init_ = std::thread([=, this]() { run(argc, argv, level); });
+      }
+      else
+      {
+        init_thread(argc, argv, ts);
+        prepare();
+      }
+    }
+
+    // Body of the helper thread: initialize MPI then wait for the context to finalize it
+    void run(int* argc, char*** argv, thread_support ts)
+    {
+      init_thread(argc, argv, ts);
+
+      std::unique_lock lock(state_);
+      initialized_ = true;
+      signal_.notify_all();
+      signal_.wait(lock, [&]() { return finalizing_; });
+      lock.unlock();
+
+      MPI_Finalize();
+    }
+
     void init_thread(int* argc, char*** argv, thread_support ts)
     {
       int provided_level;
@@ -109,13 +273,52 @@ namespace mmm
 
     void prepare()
     {
-      MPI_Comm_size(MPI_COMM_WORLD, &size);
-      MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+      prepared_ = true;
+      detail::attach(types_);
+
+      world_  = communicator(MPI_COMM_WORLD);
+      size    = world_.size();
+      rank    = world_.rank();
+
+      if(!lazy_)
+      {
+        load_name();
+        load_nodes();
+      }
+    }
+
+    void load_name()
+    {
+      std::call_once( name_loaded_
+                    , [&]()
+                      {
+                        int length;
+                        char buffer[MPI_MAX_PROCESSOR_NAME];
+                        MPI_Get_processor_name(buffer, &length);
+                        node_id = std::string ( &buffer[0]
+                                              , static_cast<std::string::size_type>(length)
+                                              );
+                      }
+                    );
+    }
+
+    void load_nodes()
+    {
+      std::call_once( nodes_loaded_
+                    , [&]()
+                      {
+                        node_       = world_.split_type(shared, rank);
+                        node_rank   = node_.rank();
+                        node_size   = node_.size();
+                        leaders_    = world_.split(node_rank ? MPI_UNDEFINED : 0, rank);
 
-      int length;
-      char buffer[MPI_MAX_PROCESSOR_NAME];
-      MPI_Get_processor_name(buffer, &length);
-      node_id = std::string(&buffer[0], static_cast<std::string::size_type>(length));
+                        // Leaders know the node layout and share it with the rest of their node
+                        int layout[2] = { leaders_.size(), leaders_.rank() };
+                        MPI_Bcast(layout, 2, MPI_INT, 0, node_.handle());
+                        node_count  = layout[0];
+                        node_index  = layout[1];
+                      }
+                    );
     }
   };
 }
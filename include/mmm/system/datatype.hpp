@@ -9,10 +9,14 @@
 
 #include <mpi.h>
 #include <mmm/detail/overload.hpp>
+#include <mmm/detail/reflection.hpp>
 #include <mmm/system/context.hpp>
 #include <mmm/system/traits.hpp>
+#include <array>
+#include <complex>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 namespace mmm::tags
@@ -21,10 +25,10 @@ namespace mmm::tags
   {
     using callable<datatype_>::operator();
 
-    template<typename T>
-    auto operator()(type_t<T> const& x) const noexcept -> decltype(tag_dispatch(*this, x))
+    template<typename... Ts>
+    auto operator()(Ts const&... x) const noexcept -> decltype(tag_dispatch(*this, x...))
     {
-      return tag_dispatch(*this, x);
+      return tag_dispatch(*this, x...);
     }
   };
 }
@@ -60,6 +64,27 @@ namespace mmm
   //!
   //! The `MPI_Datatype` value associated to `T`.
   //!
+  //! Arithmetic types, `std::complex`, `std::byte` and enumerations are mapped to the predefined MPI
+  //! types, so that predefined reduction operations can be applied to them. Enumerations use the
+  //! type associated to their underlying type.
+  //!
+  //! Beside those predefined MPI types, `T` can also be a `std::array` or a C array, which are
+  //! described as a contiguous sequence of their elements, or an aggregate, a `std::tuple` or a
+  //! `kumi::tuple` which members all have an associated `MPI_Datatype`. In this case, a derived
+  //! datatype is built and committed on the first call, then reused by all subsequent calls until
+  //! the mmm::context is destroyed. Derived datatypes can then only be requested while a
+  //! mmm::context is alive.
+  //!
+  //! If such an aggregate or tuple is trivially copyable and contains no padding, its datatype is a contiguous
+  //! sequence of `MPI_BYTE` instead of a struct datatype, so that its transfer takes the same
+  //! path as raw bytes.
+  //!
+  //! Layout descriptors like mmm::view can also be passed directly to retrieve the
+  //! `MPI_Datatype` describing the memory they cover.
+  //!
+  //! A second parameter, like a [projection](@ref mmm::fields) of some of the members of `T`, can
+  //! be passed to retrieve a `MPI_Datatype` describing only parts of each `T`.
+  //!
   //================================================================================================
   inline constexpr tags::datatype_ datatype = {};
 }
@@ -94,6 +119,29 @@ namespace mmm::tags
     else if constexpr( !std::is_signed_v<T> && sizeof(T) == 8 ) return MPI_UINT64_T;
   }
 
+  // complex cases
+  template<std::floating_point T>
+  auto tag_dispatch(datatype_ const&, type_t<std::complex<T>> ) noexcept
+  {
+    if      constexpr( std::same_as<T, float>      ) return MPI_C_FLOAT_COMPLEX;
+    else if constexpr( std::same_as<T, double>     ) return MPI_C_DOUBLE_COMPLEX;
+    else if constexpr( std::same_as<T, long double>) return MPI_C_LONG_DOUBLE_COMPLEX;
+  }
+
+  // enumerations are sent as their underlying type
+  template<typename T>
+  requires std::is_enum_v<T>
+  auto tag_dispatch(datatype_ const&, type_t<T> ) noexcept
+  {
+    return mmm::datatype(mmm::type<std::underlying_type_t<T>>);
+  }
+
+  // std::byte is an enumeration but has its own MPI type
+  inline auto tag_dispatch(datatype_ const&, type_t<std::byte> ) noexcept
+  {
+    return MPI_BYTE;
+  }
+
   // Specific pair types
   inline auto tag_dispatch(datatype_ const&, type_t<std::pair<float, int>> ) noexcept
   {
@@ -125,3 +173,128 @@ namespace mmm::tags
     return MPI_LONG_INT;
   }
 }
+
+//==================================================================================================
+// Derived datatypes support
+//==================================================================================================
+namespace mmm::detail
+{
+  template<typename T>
+  concept has_datatype = requires { mmm::datatype(mmm::type<T>); };
+
+  template<typename Fields> inline constexpr bool all_have_datatype = false;
+
+  template<typename... Fs>
+  inline constexpr bool all_have_datatype<kumi::tuple<Fs...>> = (sizeof...(Fs) > 0)
+                                                              && (has_datatype<Fs> && ...);
+
+  // Aggregates and tuple-like types which members can all be described to MPI
+  template<typename T>
+  concept structured =  (reflectable<T> || tuple_like<T>) && std::default_initializable<T>
+                    &&  all_have_datatype<fields_t<T>>;
+
+  template<typename T, typename Fields> inline constexpr bool is_packed = false;
+  template<typename T>                  inline constexpr bool is_packed_array = false;
+
+  template<typename T> inline constexpr bool is_complex                  = false;
+  template<typename T> inline constexpr bool is_complex<std::complex<T>> = true;
+
+  // Trivially copyable types which bytes are all part of their value representation
+  template<typename T>
+  concept padding_free  =   std::is_trivially_copyable_v<T>
+                        &&  (   std::has_unique_object_representations_v<T>
+                            ||  std::is_arithmetic_v<T> || is_complex<T>
+                            ||  is_packed_array<T>
+                            ||  (structured<T> && is_packed<T, fields_t<T>>)
+                            );
+
+  template<typename T, std::size_t N>
+  inline constexpr bool is_packed_array<T[N]> = padding_free<T>;
+
+  // No room is left for padding if the members' sizes add up to the size of the whole type
+  template<typename T, typename... Fs>
+  inline constexpr bool is_packed<T, kumi::tuple<Fs...>>  =   (padding_free<Fs> && ...)
+                                                          &&  ((sizeof(Fs) + ...) == sizeof(T));
+
+  // Commit a derived datatype and hand its ownership over to the current context
+  inline MPI_Datatype commit(MPI_Datatype t) { return types().adopt(t); }
+
+  // Build a struct datatype matching the layout of T, including its trailing padding
+  template<structured T> MPI_Datatype make_struct() noexcept
+  {
+    T     model{};
+    auto  fields = tie_fields(model);
+    constexpr auto n = kumi::size_v<decltype(fields)>;
+
+    int           lengths[n];
+    MPI_Aint      offsets[n];
+    MPI_Datatype  types[n];
+
+    kumi::for_each_index( [&](auto i, auto& f)
+                          {
+                            auto base = reinterpret_cast<char const*>(std::addressof(model));
+                            auto addr = reinterpret_cast<char const*>(std::addressof(f));
+
+                            lengths[i] = 1;
+                            offsets[i] = addr - base;
+                            types[i]   = mmm::datatype(mmm::type<std::remove_cvref_t<decltype(f)>>);
+                          }
+                        , fields
+                        );
+
+    MPI_Datatype raw, that;
+    MPI_Type_create_struct(static_cast<int>(n), lengths, offsets, types, &raw);
+    MPI_Type_create_resized(raw, 0, static_cast<MPI_Aint>(sizeof(T)), &that);
+    MPI_Type_free(&raw);
+
+    return that;
+  }
+
+  // Build a contiguous datatype of N elements of type T
+  template<typename T, std::size_t N> MPI_Datatype make_contiguous() noexcept
+  {
+    MPI_Datatype that;
+    MPI_Type_contiguous(static_cast<int>(N), mmm::datatype(mmm::type<T>), &that);
+    return that;
+  }
+
+  // Build a contiguous datatype of bytes spanning T
+  template<typename T> MPI_Datatype make_bytes() noexcept
+  {
+    MPI_Datatype that;
+    MPI_Type_contiguous(static_cast<int>(sizeof(T)), MPI_BYTE, &that);
+    return that;
+  }
+
+  // Padding-free types are sent as raw bytes to avoid the generic struct packing path
+  template<structured T> MPI_Datatype make_derived() noexcept
+  {
+    if constexpr( padding_free<T> ) return make_bytes<T>();
+    else                            return make_struct<T>();
+  }
+}
+
+namespace mmm::tags
+{
+  // Aggregates, std::tuple and kumi::tuple cases
+  template<detail::structured T>
+  auto tag_dispatch(datatype_ const&, type_t<T> ) noexcept
+  {
+    return detail::types().get<T>(detail::make_derived<T>);
+  }
+
+  // std::array and C arrays cases
+  template<typename T, std::size_t N>
+  requires detail::has_datatype<T>
+  auto tag_dispatch(datatype_ const&, type_t<std::array<T,N>> ) noexcept
+  {
+    return detail::types().get<std::array<T,N>>(detail::make_contiguous<T,N>);
+  }
+
+  template<typename T, std::size_t N>
+  requires detail::has_datatype<T>
+  auto tag_dispatch(datatype_ const&, type_t<T[N]> ) noexcept
+  {
+    return detail::types().get<T[N]>(detail::make_contiguous<T,N>);
+  }
+}
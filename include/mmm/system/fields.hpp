@@ -0,0 +1,92 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/system/datatype.hpp>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace mmm
+{
+  //! Compile-time list of data members used to project a type onto some of its members
+  template<auto... Members> struct projection {};
+
+  //================================================================================================
+  //! @var fields
+  //! @brief Projection of a type onto some of its data members
+  //!
+  //! Passing `mmm::fields<&T::a, &T::b, ...>` after `mmm::type<T>` to mmm::datatype gives a
+  //! datatype selecting only those members in each `T`. This datatype is resized to `sizeof(T)`,
+  //! so that sending N elements of an array of `T` only moves the selected members, without
+  //! copying them first in a staging buffer.
+  //!
+  //! @code
+  //! struct particle { double x[3], v[3], f[3]; int id, cell; };
+  //!
+  //! auto t = mmm::datatype(mmm::type<particle>, mmm::fields<&particle::x, &particle::v>);
+  //! MPI_Send(ps.data(), static_cast<int>(ps.size()), t, peer, 0, MPI_COMM_WORLD);
+  //! @endcode
+  //!
+  //! Receiving with the same datatype only overwrites the selected members of each element. The
+  //! datatype is built once for each projection and reused until the mmm::context is destroyed.
+  //================================================================================================
+  template<auto... Members> inline constexpr projection<Members...> fields = {};
+}
+
+//==================================================================================================
+// projection datatype support
+//==================================================================================================
+namespace mmm::detail
+{
+  template<typename M>              struct member_of;
+  template<typename C, typename T>  struct member_of<T C::*> { using class_type = C; using type = T; };
+
+  template<auto M> using member_class_t = typename member_of<decltype(M)>::class_type;
+  template<auto M> using member_type_t  = typename member_of<decltype(M)>::type;
+
+  // Offset of a data member computed from an object whose lifetime never started
+  template<typename T, auto M> std::ptrdiff_t offset_of() noexcept
+  {
+    union storage { storage() {} ~storage() {} T value; } s;
+    auto base = reinterpret_cast<char const*>(std::addressof(s.value));
+    auto addr = reinterpret_cast<char const*>(std::addressof(s.value.*M));
+    return addr - base;
+  }
+
+  template<typename T, auto... Ms> MPI_Datatype make_projection() noexcept
+  {
+    constexpr auto n = sizeof...(Ms);
+
+    int           lengths[n] = { (static_cast<void>(Ms), 1)... };
+    MPI_Aint      offsets[n] = { static_cast<MPI_Aint>(offset_of<T, Ms>())... };
+    MPI_Datatype  types[n]   = { mmm::datatype(mmm::type<std::remove_cv_t<member_type_t<Ms>>>)... };
+
+    MPI_Datatype raw, that;
+    MPI_Type_create_struct(static_cast<int>(n), lengths, offsets, types, &raw);
+    MPI_Type_create_resized(raw, 0, static_cast<MPI_Aint>(sizeof(T)), &that);
+    MPI_Type_free(&raw);
+
+    return that;
+  }
+}
+
+namespace mmm::tags
+{
+  template<typename T, auto... Ms>
+  requires(     sizeof...(Ms) > 0
+            &&  (std::is_member_object_pointer_v<decltype(Ms)> && ...)
+            &&  (std::is_base_of_v<detail::member_class_t<Ms>, T> && ...)
+            &&  (detail::has_datatype<std::remove_cv_t<detail::member_type_t<Ms>>> && ...)
+          )
+  auto tag_dispatch(datatype_ const&, type_t<T>, projection<Ms...> ) noexcept
+  {
+    return detail::types().get<T, projection<Ms...>>(detail::make_projection<T, Ms...>);
+  }
+}
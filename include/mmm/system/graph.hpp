@@ -0,0 +1,311 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/large_count.hpp>
+#include <mmm/system/communicator.hpp>
+#include <mmm/system/datatype.hpp>
+#include <mmm/system/request.hpp>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mmm::detail
+{
+  template<typename T>
+  concept neighbor_buffer =   std::ranges::contiguous_range<T> && std::ranges::sized_range<T>
+                          &&  has_datatype<std::remove_cv_t<std::ranges::range_value_t<T>>>;
+
+  template<typename T>
+  MPI_Datatype element_type(T const&) noexcept
+  {
+    return mmm::datatype(mmm::type<std::remove_cv_t<std::ranges::range_value_t<T>>>);
+  }
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct neighbor_request
+  //! @brief Pending vector neighborhood collective
+  //!
+  //! Counts, displacements and datatypes passed to a nonblocking vector neighborhood collective
+  //! must stay alive until it completes. mmm::neighbor_request keeps them along the request and
+  //! completes it when destroyed. Only mmm::graph builds active neighbor requests.
+  //================================================================================================
+  struct neighbor_request
+  {
+    //! Is the collective still pending ?
+    bool          active() const noexcept { return req_.active(); }
+    //! Underlying `MPI_Request` handle
+    MPI_Request   handle() const noexcept { return req_.handle(); }
+    //! Handle of the collective or `nullptr` if none was posted
+    MPI_Request*  first()        noexcept { return req_.first(); }
+
+    //! Block until the collective completes
+    MPI_Status    wait()                                  { return req_.wait(); }
+    //! Check if the collective completed without blocking
+    bool          test(MPI_Status* s = MPI_STATUS_IGNORE) { return req_.test(s); }
+
+    //! Call `f` on each `MPI_Request` handle of the collective
+    template<typename F> void for_each(F f) { req_.for_each(f); }
+
+    private:
+    friend struct graph;
+
+    std::vector<detail::count_type>         counts_;
+    std::vector<detail::displacement_type>  offsets_;
+    std::vector<MPI_Aint>                   displs_;
+    std::vector<MPI_Datatype>               types_;
+    request                                 req_;
+  };
+
+  //================================================================================================
+  //! @struct graph
+  //! @brief Communicator with a distributed graph topology
+  //!
+  //! mmm::graph builds a communicator with `MPI_Dist_graph_create_adjacent` from the neighbors of
+  //! the current process. It provides typed neighborhood collectives where each process only
+  //! exchanges data with its neighbors, so that the MPI library can schedule all those exchanges
+  //! at once. Element datatypes are deduced with mmm::datatype.
+  //!
+  //! Data received from the i-th source is stored in the i-th block of the output and the i-th
+  //! block of the input is sent to the i-th destination.
+  //!
+  //! Blocking collectives return the MPI error code of the operation. If the MPI library doesn't
+  //! provide the MPI-4 large-count routines, counts or displacements that an `int` can't hold are
+  //! rejected with `MPI_ERR_COUNT` and nonblocking collectives then return an inactive request.
+  //!
+  //! @code
+  //! mmm::graph mesh(ctx.world(), neighbors);
+  //!
+  //! std::vector<double> mine(k), theirs(k * mesh.in_degree());
+  //! mesh.neighbor_allgather(mine, theirs);
+  //! @endcode
+  //================================================================================================
+  struct graph
+  {
+    //! @brief Build a distributed graph communicator from a list of neighbors
+    //! This operation is collective over all processes of `base`. The graph must be symmetric:
+    //! each neighbor of the current process must also list it as a neighbor.
+    //! @param base       Communicator containing the processes
+    //! @param neighbors  Ranks in `base` of the processes exchanging data with current process
+    graph(communicator const& base, std::span<int const> neighbors)
+        : graph(base, neighbors, neighbors)
+    {}
+
+    //! @brief Build a distributed graph communicator from lists of sources and destinations
+    //! This operation is collective over all processes of `base`.
+    //! @param base         Communicator containing the processes
+    //! @param sources      Ranks in `base` of the processes sending data to current process
+    //! @param destinations Ranks in `base` of the processes receiving data from current process
+    //! @param reorder      Can the MPI library reorder the ranks of the processes ?
+    //! @throws std::length_error if there are more sources or destinations than an `int` can count
+    graph ( communicator const& base
+          , std::span<int const> sources, std::span<int const> destinations
+          , bool reorder = false
+          )
+    {
+      auto limit = static_cast<std::size_t>(std::numeric_limits<int>::max());
+      if(sources.size() > limit || destinations.size() > limit)
+        throw std::length_error("[MMM] - Too many neighbors to build a distributed graph");
+
+      MPI_Comm that;
+      MPI_Dist_graph_create_adjacent( base.handle()
+                                    , static_cast<int>(sources.size())
+                                    , sources.data(), MPI_UNWEIGHTED
+                                    , static_cast<int>(destinations.size())
+                                    , destinations.data(), MPI_UNWEIGHTED
+                                    , MPI_INFO_NULL, reorder ? 1 : 0, &that
+                                    );
+      comm_ = communicator(that);
+
+      // Neighbors are retrieved from the new communicator as ranks may have been reordered
+      int in, out, weighted;
+      MPI_Dist_graph_neighbors_count(comm_.handle(), &in, &out, &weighted);
+      sources_.resize(static_cast<std::size_t>(in));
+      destinations_.resize(static_cast<std::size_t>(out));
+      MPI_Dist_graph_neighbors( comm_.handle()
+                              , in , sources_.data()     , MPI_UNWEIGHTED
+                              , out, destinations_.data(), MPI_UNWEIGHTED
+                              );
+    }
+
+    //! Underlying communicator
+    communicator const&     comm()          const noexcept { return comm_; }
+    //! Number of processes in the graph
+    int                     size()          const noexcept { return comm_.size(); }
+    //! Rank of current process in the graph
+    int                     rank()          const noexcept { return comm_.rank(); }
+    //! Ranks of the processes sending data to current process
+    std::vector<int> const& sources()       const noexcept { return sources_; }
+    //! Ranks of the processes receiving data from current process
+    std::vector<int> const& destinations()  const noexcept { return destinations_; }
+    //! Number of sources
+    std::size_t             in_degree()     const noexcept { return sources_.size(); }
+    //! Number of destinations
+    std::size_t             out_degree()    const noexcept { return destinations_.size(); }
+
+    //! Synchronize all processes of the graph
+    void synchronize() const { comm_.synchronize(); }
+
+    //! @brief Gather the same block from every source
+    //! @param in   Block sent to every destination
+    //! @param out  Blocks received from each source, of size `in.size() * in_degree()`
+    template<detail::neighbor_buffer In, detail::neighbor_buffer Out>
+    int neighbor_allgather(In const& in, Out& out) const
+    {
+      return detail::neighbor_allgather ( std::ranges::data(in), std::ranges::size(in)
+                                        , detail::element_type(in), std::ranges::data(out)
+                                        , comm_.handle()
+                                        );
+    }
+
+    //! Start gathering the same block from every source. See graph::neighbor_allgather.
+    template<detail::neighbor_buffer In, detail::neighbor_buffer Out>
+    request ineighbor_allgather(In const& in, Out& out) const
+    {
+      MPI_Request r;
+      auto e = detail::ineighbor_allgather( std::ranges::data(in), std::ranges::size(in)
+                                          , detail::element_type(in), std::ranges::data(out)
+                                          , comm_.handle(), &r
+                                          );
+      return e == MPI_SUCCESS ? request(r) : request();
+    }
+
+    //! @brief Send a distinct block to every destination and receive one from every source
+    //! @param in   Blocks sent to each destination, all of the same size
+    //! @param out  Blocks received from each source, all of the same size
+    template<detail::neighbor_buffer In, detail::neighbor_buffer Out>
+    int neighbor_alltoall(In const& in, Out& out) const
+    {
+      return detail::neighbor_alltoall( std::ranges::data(in), block_size(in)
+                                      , detail::element_type(in), std::ranges::data(out)
+                                      , comm_.handle()
+                                      );
+    }
+
+    //! Start exchanging a distinct block with every neighbor. See graph::neighbor_alltoall.
+    template<detail::neighbor_buffer In, detail::neighbor_buffer Out>
+    request ineighbor_alltoall(In const& in, Out& out) const
+    {
+      MPI_Request r;
+      auto e = detail::ineighbor_alltoall ( std::ranges::data(in), block_size(in)
+                                          , detail::element_type(in), std::ranges::data(out)
+                                          , comm_.handle(), &r
+                                          );
+      return e == MPI_SUCCESS ? request(r) : request();
+    }
+
+    //! @brief Exchange blocks of different sizes with every neighbor
+    //! @param in           Contiguous blocks sent to each destination
+    //! @param send_counts  Number of elements sent to each destination
+    //! @param out          Contiguous blocks received from each source
+    //! @param recv_counts  Number of elements received from each source
+    template<detail::neighbor_buffer In, detail::neighbor_buffer Out>
+    int neighbor_alltoallv( In const& in, std::span<std::size_t const> send_counts
+                          , Out&      out, std::span<std::size_t const> recv_counts
+                          ) const
+    {
+      return detail::neighbor_alltoallv ( std::ranges::data(in) , send_counts
+                                        , std::ranges::data(out), recv_counts
+                                        , detail::element_type(in), comm_.handle()
+                                        );
+    }
+
+    //! Start exchanging blocks of different sizes. See graph::neighbor_alltoallv.
+    template<detail::neighbor_buffer In, detail::neighbor_buffer Out>
+    neighbor_request ineighbor_alltoallv( In const& in, std::span<std::size_t const> send_counts
+                                        , Out&      out, std::span<std::size_t const> recv_counts
+                                        ) const
+    {
+      neighbor_request args;
+
+      MPI_Request r;
+      auto e = detail::ineighbor_alltoallv( std::ranges::data(in) , send_counts
+                                          , std::ranges::data(out), recv_counts
+                                          , detail::element_type(in), comm_.handle()
+                                          , args.counts_, args.offsets_, &r
+                                          );
+      if(e == MPI_SUCCESS) args.req_ = request(r);
+      return args;
+    }
+
+    //! @brief Exchange arbitrary layouts with every neighbor
+    //! Each element of `in` and `out` is a value with an associated datatype and a `data()`
+    //! member, like mmm::view or mmm::scattered, describing the region exchanged with the
+    //! corresponding neighbor.
+    //! @param in   Regions sent to each destination
+    //! @param out  Regions received from each source
+    template<std::ranges::sized_range In, std::ranges::sized_range Out>
+    int neighbor_alltoallw(In const& in, Out const& out) const
+    {
+      auto args = layout_w(in, out);
+      return detail::neighbor_alltoallw ( args.counts_.data(), args.displs_.data()
+                                        , args.types_.data(), std::ranges::size(in)
+                                        , comm_.handle()
+                                        );
+    }
+
+    //! Start exchanging arbitrary layouts with every neighbor. See graph::neighbor_alltoallw.
+    template<std::ranges::sized_range In, std::ranges::sized_range Out>
+    neighbor_request ineighbor_alltoallw(In const& in, Out const& out) const
+    {
+      auto args = layout_w(in, out);
+
+      MPI_Request r;
+      auto e = detail::ineighbor_alltoallw( args.counts_.data(), args.displs_.data()
+                                          , args.types_.data(), std::ranges::size(in)
+                                          , comm_.handle(), &r
+                                          );
+      if(e == MPI_SUCCESS) args.req_ = request(r);
+      return args;
+    }
+
+    private:
+    template<typename T> std::size_t block_size(T const& in) const noexcept
+    {
+      auto n = std::ranges::size(in);
+      return destinations_.empty() ? 0 : n / destinations_.size();
+    }
+
+    // Absolute address and datatype of each send and receive region
+    template<typename In, typename Out>
+    static neighbor_request layout_w(In const& in, Out const& out)
+    {
+      auto n = std::ranges::size(in) + std::ranges::size(out);
+
+      neighbor_request args;
+      args.counts_.assign(n, 1);
+      args.displs_.reserve(n);
+      args.types_.reserve(n);
+
+      auto add = [&](auto const& x)
+      {
+        MPI_Aint address;
+        MPI_Get_address(x.data(), &address);
+        args.displs_.push_back(address);
+        args.types_.push_back(mmm::datatype(x));
+      };
+
+      for(auto const& x : in)  add(x);
+      for(auto const& x : out) add(x);
+      return args;
+    }
+
+    communicator      comm_;
+    std::vector<int>  sources_;
+    std::vector<int>  destinations_;
+  };
+}
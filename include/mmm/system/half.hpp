@@ -0,0 +1,132 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/system/datatype.hpp>
+#include <mmm/system/op.hpp>
+#include <mmm/system/reduction.hpp>
+#include <bit>
+#include <cstdint>
+
+#if defined(__STDCPP_FLOAT16_T__)
+#include <stdfloat>
+#endif
+
+#if defined(__STDCPP_FLOAT16_T__) || defined(__FLT16_MAX__)
+#define MMM_HAS_FLOAT16
+#endif
+
+namespace mmm
+{
+#if defined(__STDCPP_FLOAT16_T__)
+  //! IEEE 754 binary16 type
+  using float16 = std::float16_t;
+#elif defined(__FLT16_MAX__)
+  //! IEEE 754 binary16 type
+  using float16 = _Float16;
+#endif
+
+  //================================================================================================
+  //! @struct bfloat16
+  //! @brief Brain floating-point format type
+  //!
+  //! mmm::bfloat16 stores the 16 most significant bits of a IEEE 754 binary32 value. It is a pure
+  //! storage and transport type: computations are expected to be performed after converting its
+  //! value to `float`.
+  //================================================================================================
+  struct bfloat16
+  {
+    //! Build a bfloat16 equal to +0
+    constexpr bfloat16() noexcept : bits{} {}
+
+    //! Build a bfloat16 from a float rounded to the nearest, ties to even.
+    constexpr explicit bfloat16(float f) noexcept : bits(round(std::bit_cast<std::uint32_t>(f))) {}
+
+    //! Convert to float without loss
+    constexpr explicit operator float() const noexcept
+    {
+      return std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16);
+    }
+
+    friend constexpr bool operator==(bfloat16, bfloat16) noexcept = default;
+
+    //! Bit pattern of the value
+    std::uint16_t bits;
+
+    private:
+    static constexpr std::uint16_t round(std::uint32_t u) noexcept
+    {
+      // NaNs are kept quiet, other values rounded to nearest even without branches
+      auto nan  = static_cast<std::uint16_t>((u >> 16) | 0x40);
+      auto rnd  = static_cast<std::uint16_t>((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+      return ((u & 0x7FFFFFFF) > 0x7F800000) ? nan : rnd;
+    }
+  };
+}
+
+//==================================================================================================
+// Half precision datatype and reductions support
+//==================================================================================================
+namespace mmm::detail
+{
+  // 16 bits types are moved as raw bytes under a dedicated named datatype
+  inline MPI_Datatype make_half(char const* name) noexcept
+  {
+    MPI_Datatype that;
+    MPI_Type_contiguous(2, MPI_BYTE, &that);
+    MPI_Type_set_name(that, name);
+    return that;
+  }
+
+  // Combine 16 bits values by computing in fp32
+  template<typename T, typename Op> struct widen
+  {
+    constexpr T operator()(T a, T b) const noexcept
+    {
+      return static_cast<T>(Op{}(static_cast<float>(a), static_cast<float>(b)));
+    }
+  };
+
+  struct half_plus { constexpr float operator()(float a, float b) const noexcept { return a + b;         } };
+  struct half_max  { constexpr float operator()(float a, float b) const noexcept { return a < b ? b : a; } };
+  struct half_min  { constexpr float operator()(float a, float b) const noexcept { return b < a ? b : a; } };
+
+  template<typename T> MPI_Op half_op(MPI_Op op) noexcept
+  {
+    if      (op == MPI_SUM) return mmm::op[commutative](widen<T, half_plus>{}, mmm::type<T>);
+    else if (op == MPI_MAX) return mmm::op[commutative](widen<T, half_max >{}, mmm::type<T>);
+    else if (op == MPI_MIN) return mmm::op[commutative](widen<T, half_min >{}, mmm::type<T>);
+    else                    return MPI_OP_NULL;
+  }
+}
+
+namespace mmm::tags
+{
+  inline auto tag_dispatch(datatype_ const&, type_t<bfloat16> ) noexcept
+  {
+    return detail::types().get<bfloat16>([]() { return detail::make_half("mmm::bfloat16"); });
+  }
+
+  inline MPI_Op tag_dispatch(reduction_ const&, MPI_Op op, type_t<bfloat16> ) noexcept
+  {
+    return detail::half_op<bfloat16>(op);
+  }
+
+#if defined(MMM_HAS_FLOAT16)
+  inline auto tag_dispatch(datatype_ const&, type_t<float16> ) noexcept
+  {
+    return detail::types().get<float16>([]() { return detail::make_half("mmm::float16"); });
+  }
+
+  inline MPI_Op tag_dispatch(reduction_ const&, MPI_Op op, type_t<float16> ) noexcept
+  {
+    return detail::half_op<float16>(op);
+  }
+#endif
+}
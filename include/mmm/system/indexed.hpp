@@ -0,0 +1,181 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/system/datatype.hpp>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct indexed
+  //! @brief Non-owning description of a sparse selection of elements
+  //!
+  //! mmm::indexed describes blocks of elements scattered in a buffer by the index of their first
+  //! element. Passing it to mmm::datatype gives a `MPI_Datatype` selecting those blocks, so that
+  //! ghost values can be sent straight from their storage by using `x.data()` as buffer and a
+  //! count of 1.
+  //!
+  //! Blocks of identical length are described by `MPI_Type_create_hindexed_block`, blocks of
+  //! varying length by `MPI_Type_create_hindexed`. Indexes are turned into byte displacements so
+  //! that they can be of any integral type. Datatypes are cached by index pattern, so every
+  //! mmm::indexed built over the same pattern reuses the same committed datatype.
+  //!
+  //! Selections with more blocks, or longer blocks, than an `int` can count have no datatype:
+  //! mmm::datatype returns `MPI_DATATYPE_NULL` for them.
+  //!
+  //! @code
+  //! std::vector<int> ghosts = { 3, 17, 42, 108 };
+  //! mmm::indexed sel(field.data(), ghosts);
+  //! MPI_Send(sel.data(), 1, mmm::datatype(sel), peer, 0, MPI_COMM_WORLD);
+  //! @endcode
+  //!
+  //! @tparam T     Type of the selected elements
+  //! @tparam Index Integral type of the indexes
+  //================================================================================================
+  template<typename T, std::integral Index = int>
+  struct indexed
+  {
+    //! Type of the selected elements
+    using value_type  = T;
+    //! Type of the indexes
+    using index_type  = Index;
+
+    //! @brief Construct a selection of blocks of identical length
+    //! @param data     Pointer to the buffer to select from
+    //! @param indices  Index of the first element of each block
+    //! @param length   Number of elements in each block
+    constexpr indexed(T* data, std::span<Index const> indices, Index length = 1) noexcept
+            : data_(data), indices_(indices), lengths_{}, length_(length)
+            , hash_(hash_of(indices, lengths_, length))
+    {}
+
+    //! @brief Construct a selection of blocks of varying length
+    //! @param data     Pointer to the buffer to select from
+    //! @param indices  Index of the first element of each block
+    //! @param lengths  Number of elements in each block
+    constexpr indexed(T* data, std::span<Index const> indices, std::span<Index const> lengths) noexcept
+            : data_(data), indices_(indices), lengths_(lengths), length_(0)
+            , hash_(hash_of(indices, lengths, 0))
+    {}
+
+    //! Pointer to the buffer to select from
+    constexpr T*                      data()    const noexcept { return data_;    }
+    //! Index of the first element of each block
+    constexpr std::span<Index const>  indices() const noexcept { return indices_; }
+    //! Number of elements in each block if they vary, empty otherwise
+    constexpr std::span<Index const>  lengths() const noexcept { return lengths_; }
+    //! Number of elements in each block if they are identical, 0 otherwise
+    constexpr Index                   length()  const noexcept { return length_;  }
+    //! Hash of the selection pattern
+    constexpr std::size_t             hash()    const noexcept { return hash_;    }
+
+    //! Total number of selected elements
+    constexpr std::ptrdiff_t size() const noexcept
+    {
+      if(lengths_.empty()) return static_cast<std::ptrdiff_t>(indices_.size()) * length_;
+
+      std::ptrdiff_t n = 0;
+      for(auto l : lengths_) n += l;
+      return n;
+    }
+
+    private:
+    static constexpr std::size_t hash_of( std::span<Index const> is, std::span<Index const> ls
+                                        , Index l
+                                        ) noexcept
+    {
+      std::array<std::ptrdiff_t, 2> header = { static_cast<std::ptrdiff_t>(l)
+                                            , static_cast<std::ptrdiff_t>(is.size())
+                                            };
+      return detail::hash_pattern(header, is, ls);
+    }
+
+    T*                      data_;
+    std::span<Index const>  indices_;
+    std::span<Index const>  lengths_;
+    Index                   length_;
+    std::size_t             hash_;
+  };
+
+  template<typename T, std::ranges::contiguous_range R>
+  indexed(T*, R const&) -> indexed<T, std::ranges::range_value_t<R>>;
+
+  template<typename T, std::ranges::contiguous_range R>
+  indexed(T*, R const&, std::ranges::range_value_t<R>) -> indexed<T, std::ranges::range_value_t<R>>;
+
+  template<typename T, std::ranges::contiguous_range R>
+  indexed(T*, R const&, R const&) -> indexed<T, std::ranges::range_value_t<R>>;
+}
+
+//==================================================================================================
+// indexed datatype support
+//==================================================================================================
+namespace mmm::detail
+{
+  template<typename T, typename Index>
+  MPI_Datatype make_indexed(indexed<T,Index> const& x) noexcept
+  {
+    auto fits = [](auto n) { return std::in_range<int>(n); };
+    if(!fits(x.indices().size()) || !fits(x.length()) || !std::ranges::all_of(x.lengths(), fits))
+      return MPI_DATATYPE_NULL;
+
+    auto base   = mmm::datatype(mmm::type<std::remove_cv_t<T>>);
+    auto count  = static_cast<int>(x.indices().size());
+    auto size   = static_cast<MPI_Aint>(sizeof(T));
+
+    std::vector<MPI_Aint> displacements(x.indices().size());
+    std::ranges::transform( x.indices(), displacements.begin()
+                          , [size](auto i) { return static_cast<MPI_Aint>(i) * size; }
+                          );
+
+    MPI_Datatype that;
+    if(x.lengths().empty())
+    {
+      MPI_Type_create_hindexed_block( count, static_cast<int>(x.length()), displacements.data()
+                                    , base, &that
+                                    );
+    }
+    else
+    {
+      std::vector<int> lengths(x.lengths().size());
+      std::ranges::transform( x.lengths(), lengths.begin()
+                            , [](auto l) { return static_cast<int>(l); }
+                            );
+      MPI_Type_create_hindexed(count, lengths.data(), displacements.data(), base, &that);
+    }
+
+    return that;
+  }
+}
+
+namespace mmm::tags
+{
+  template<typename T, typename Index>
+  requires detail::has_datatype<std::remove_cv_t<T>>
+  auto tag_dispatch(datatype_ const&, indexed<T,Index> const& x) noexcept
+  {
+    // Patterns are prefixed by the common length and the number of blocks to be unambiguous
+    std::array<std::ptrdiff_t, 2> header = { static_cast<std::ptrdiff_t>(x.length())
+                                          , static_cast<std::ptrdiff_t>(x.indices().size())
+                                          };
+
+    return detail::types().get<indexed<T,Index>>( x.hash()
+                                                , [&]() { return detail::make_indexed(x); }
+                                                , header, x.indices(), x.lengths()
+                                                );
+  }
+}
@@ -0,0 +1,120 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/overload.hpp>
+#include <mmm/system/context.hpp>
+#include <mmm/system/options.hpp>
+#include <mmm/system/traits.hpp>
+#include <concepts>
+#include <type_traits>
+
+namespace mmm::tags
+{
+  struct op_ : callable<op_>, support_options<op_>
+  {
+    using callable<op_>::operator();
+    using support_options<op_>::operator[];
+
+    template<typename F, typename T>
+    auto operator()(F const& f, type_t<T> const& x) const noexcept
+    -> decltype(tag_dispatch(*this, rbr::settings{}, f, x))
+    {
+      return tag_dispatch(*this, rbr::settings{}, f, x);
+    }
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var op
+  //! @brief op object function turning a C++ callable into a MPI_Op
+  //!
+  //! **Defined in Header**
+  //!
+  //! @code
+  //! #include <mmm/system/op.hpp>
+  //! @endcode
+  //!
+  //! @groupheader{Callable Signatures}
+  //!
+  //! @code
+  //! namespace mmm
+  //! {
+  //!   template<typename F, typename T >
+  //!   MPI_Op op(F f, mmm::type_t<T> target) noexcept;
+  //!
+  //!   template<typename F, typename T >
+  //!   MPI_Op op[mmm::commutative](F f, mmm::type_t<T> target) noexcept;
+  //! }
+  //! @endcode
+  //!
+  //! **Parameters:**
+  //!
+  //!   * `f`       : A stateless callable object taking two `T` and returning a `T`.
+  //!   * `target`  : A [type-to-object adapter](@ref mmm::type) instance carrying the
+  //!     type of the values to combine.
+  //!
+  //! **Options:**
+  //!
+  //!   * mmm::commutative : Flags the operation as commutative.
+  //!
+  //! **Return value:**
+  //!
+  //! A user-defined `MPI_Op` computing `inout[i] = f(in[i], inout[i])` over buffers of `T`.
+  //! The whole buffer is processed by a single loop in which `f` is inlined, so that the compiler
+  //! can vectorize it.
+  //!
+  //! The operation is created on first use for each pair of callable type and `T`, then reused
+  //! by all subsequent calls until the mmm::context is destroyed.
+  //!
+  //================================================================================================
+  inline constexpr tags::op_ op = {};
+}
+
+//==================================================================================================
+// op implementation
+//==================================================================================================
+namespace mmm::detail
+{
+  // Callables usable without any state, as MPI_Op can't carry any
+  template<typename F, typename T>
+  concept stateless_operation =   std::is_empty_v<F> && std::default_initializable<F>
+                              &&  std::is_invocable_r_v<T, F const&, T const&, T const&>;
+
+  template<typename F, typename T>
+  void apply_op(void* in, void* inout, int* len, MPI_Datatype*)
+  {
+    auto src = static_cast<T const*>(in);
+    auto dst = static_cast<T*>(inout);
+    auto n   = *len;
+    F    f{};
+
+    for(int i = 0; i < n; ++i) dst[i] = static_cast<T>(f(src[i], dst[i]));
+  }
+
+  template<typename F, typename T, bool Commutative> MPI_Op make_op() noexcept
+  {
+    MPI_Op o;
+    MPI_Op_create(&apply_op<F,T>, Commutative ? 1 : 0, &o);
+    return o;
+  }
+}
+
+namespace mmm::tags
+{
+  template<rbr::concepts::settings Settings, typename F, typename T>
+  requires detail::stateless_operation<F,T>
+  MPI_Op tag_dispatch(op_ const&, Settings const& s, F const&, type_t<T> ) noexcept
+  {
+    constexpr bool c = decltype(s[commutative])::value;
+    return detail::types().operation<F, T, std::bool_constant<c>>(detail::make_op<F, T, c>);
+  }
+}
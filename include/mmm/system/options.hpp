@@ -0,0 +1,121 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/raberu.hpp>
+#include <type_traits>
+
+namespace mmm::detail
+{
+  // Keyword checker accepting values of a given type, whatever their value category
+  template<typename Type> struct accepts
+  {
+    template<typename T> using check = std::is_same<std::remove_cvref_t<T>, Type>;
+  };
+}
+
+namespace mmm
+{
+  struct communicator;
+}
+
+namespace mmm::detail
+{
+  // MPI_Comm handle of either a raw communicator or a mmm::communicator
+  template<typename Comm> MPI_Comm comm_handle(Comm const& c) noexcept
+  {
+    if constexpr(std::is_same_v<Comm, MPI_Comm>)  return c;
+    else                                          return c.handle();
+  }
+
+  // Keyword accepting a MPI_Comm or a mmm::communicator. As mmm::communicator is move-only, it is
+  // bound as its MPI_Comm handle so that settings only ever hold a MPI_Comm.
+  template<typename ID> struct comm_keyword : rbr::as_keyword<comm_keyword<ID>>
+  {
+    template<typename T> static constexpr bool check()
+    {
+      using type = std::remove_cvref_t<T>;
+      return std::is_same_v<type, MPI_Comm> || std::is_same_v<type, communicator>;
+    }
+
+    template<typename T>
+    constexpr auto operator=(T&& c) const noexcept requires(check<T>())
+    {
+      return rbr::option<comm_keyword, MPI_Comm>{comm_handle(c)};
+    }
+
+    template<typename T>
+    constexpr auto operator|(T&& c) const noexcept requires(check<T>())
+    {
+      return rbr::detail::type_or_<comm_keyword, MPI_Comm>{comm_handle(c)};
+    }
+
+    template<typename V> std::ostream& display(std::ostream& os, V const&) const
+    {
+      return os << ID{} << " : MPI_Comm";
+    }
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var commutative
+  //! @brief Option flagging a user-defined operation as commutative
+  //!
+  //! Operations built without this flag are assumed to be only associative.
+  //================================================================================================
+  inline constexpr auto commutative = rbr::flag(rbr::id_<"commutative">{});
+
+  //================================================================================================
+  //! @var lazy
+  //! @brief Option deferring the environment queries of mmm::context to their first use
+  //================================================================================================
+  inline constexpr auto lazy        = rbr::flag(rbr::id_<"lazy">{});
+
+  //================================================================================================
+  //! @var background
+  //! @brief Option running the MPI initialization of mmm::context on a helper thread
+  //================================================================================================
+  inline constexpr auto background  = rbr::flag(rbr::id_<"background">{});
+
+  //================================================================================================
+  //! @var to
+  //! @brief Keyword setting the rank of the destination process of a message
+  //================================================================================================
+  inline constexpr auto to    = rbr::keyword<detail::accepts<int>::check>(rbr::id_<"to">{});
+
+  //================================================================================================
+  //! @var from
+  //! @brief Keyword setting the rank of the source process of a message
+  //================================================================================================
+  inline constexpr auto from  = rbr::keyword<detail::accepts<int>::check>(rbr::id_<"from">{});
+
+  //================================================================================================
+  //! @var tag
+  //! @brief Keyword setting the tag of a message
+  //================================================================================================
+  inline constexpr auto tag   = rbr::keyword<detail::accepts<int>::check>(rbr::id_<"tag">{});
+
+  //================================================================================================
+  //! @var comm
+  //! @brief Keyword setting the communicator a message is exchanged over
+  //!
+  //! Either a `MPI_Comm` or a mmm::communicator can be bound to mmm::comm.
+  //================================================================================================
+  inline constexpr auto comm  = detail::comm_keyword<rbr::id_<"comm">>{};
+
+  //================================================================================================
+  //! @var cancel_on_destroy
+  //! @brief Option cancelling a pending nonblocking operation when its mmm::request is destroyed
+  //!
+  //! Requests built without this option wait for their operation to complete.
+  //================================================================================================
+  inline constexpr auto cancel_on_destroy = rbr::flag(rbr::id_<"cancel_on_destroy">{});
+}
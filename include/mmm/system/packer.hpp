@@ -0,0 +1,375 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/large_count.hpp>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+//==================================================================================================
+// Datatype layout flattening
+//==================================================================================================
+namespace mmm::detail
+{
+  // Contiguous run of bytes at a given offset from the start of an element
+  struct block
+  {
+    std::ptrdiff_t  offset;
+    std::ptrdiff_t  length;
+  };
+
+  // Append a block, merging it with the previous one if they are adjacent
+  inline void append(std::vector<block>& out, std::ptrdiff_t offset, std::ptrdiff_t length)
+  {
+    if(length == 0) return;
+
+    if(!out.empty() && out.back().offset + out.back().length == offset)
+      out.back().length += length;
+    else
+      out.push_back({offset, length});
+  }
+
+  inline void release(MPI_Datatype& t) noexcept
+  {
+    int ni, na, nd, combiner;
+    MPI_Type_get_envelope(t, &ni, &na, &nd, &combiner);
+    if(combiner != MPI_COMBINER_NAMED) MPI_Type_free(&t);
+  }
+
+  // Append the blocks of a type located at base to out, return false on unsupported layouts
+  inline bool flatten(MPI_Datatype t, std::ptrdiff_t base, std::vector<block>& out)
+  {
+    int ni, na, nd, combiner;
+    MPI_Type_get_envelope(t, &ni, &na, &nd, &combiner);
+
+    if(combiner == MPI_COMBINER_NAMED)
+    {
+      int size;
+      MPI_Type_size(t, &size);
+      append(out, base, size);
+      return true;
+    }
+
+    std::vector<int>          is(static_cast<std::size_t>(ni));
+    std::vector<MPI_Aint>     as(static_cast<std::size_t>(na));
+    std::vector<MPI_Datatype> ts(static_cast<std::size_t>(nd));
+    MPI_Type_get_contents(t, ni, na, nd, is.data(), as.data(), ts.data());
+
+    // Replicate a child type n times from offset with a given stride, flattening it only once
+    auto run = [&](MPI_Datatype c, std::ptrdiff_t offset, std::ptrdiff_t n, std::ptrdiff_t stride)
+    {
+      std::vector<block> inner;
+      if(!flatten(c, 0, inner)) return false;
+
+      for(std::ptrdiff_t k = 0; k < n; ++k)
+        for(auto b : inner) append(out, base + offset + k * stride + b.offset, b.length);
+
+      return true;
+    };
+
+    bool ok   = true;
+    auto sub  = nd > 0 ? static_cast<std::ptrdiff_t>(extent_of(ts[0])) : std::ptrdiff_t{0};
+
+    switch(combiner)
+    {
+      case MPI_COMBINER_DUP:
+      case MPI_COMBINER_RESIZED:
+        ok = flatten(ts[0], base, out);
+        break;
+
+      case MPI_COMBINER_CONTIGUOUS:
+        ok = run(ts[0], 0, is[0], sub);
+        break;
+
+      case MPI_COMBINER_VECTOR:
+        for(int i = 0; ok && i < is[0]; ++i)
+          ok = run(ts[0], std::ptrdiff_t{i} * is[2] * sub, is[1], sub);
+        break;
+
+      case MPI_COMBINER_HVECTOR:
+        for(int i = 0; ok && i < is[0]; ++i) ok = run(ts[0], i * as[0], is[1], sub);
+        break;
+
+      case MPI_COMBINER_INDEXED:
+        for(int i = 0; ok && i < is[0]; ++i) ok = run(ts[0], is[1+is[0]+i] * sub, is[1+i], sub);
+        break;
+
+      case MPI_COMBINER_HINDEXED:
+        for(int i = 0; ok && i < is[0]; ++i) ok = run(ts[0], as[i], is[1+i], sub);
+        break;
+
+      case MPI_COMBINER_INDEXED_BLOCK:
+        for(int i = 0; ok && i < is[0]; ++i) ok = run(ts[0], is[2+i] * sub, is[1], sub);
+        break;
+
+      case MPI_COMBINER_HINDEXED_BLOCK:
+        for(int i = 0; ok && i < is[0]; ++i) ok = run(ts[0], as[i], is[1], sub);
+        break;
+
+      case MPI_COMBINER_STRUCT:
+        for(int i = 0; ok && i < is[0]; ++i)
+          ok = run(ts[i], as[i], is[1+i], extent_of(ts[i]));
+        break;
+
+      case MPI_COMBINER_SUBARRAY:
+      {
+        // Walk the sub-block in memory order, one run of the fastest dimension at a time
+        auto  ndims   = is[0];
+        auto  sizes   = is.data() + 1;
+        auto  subs    = sizes + ndims;
+        auto  starts  = subs  + ndims;
+        bool  c_order = is[1+3*ndims] == MPI_ORDER_C;
+
+        std::vector<std::ptrdiff_t> strides(static_cast<std::size_t>(ndims)), index(strides.size());
+        std::ptrdiff_t s = sub;
+        for(int i = 0; i < ndims; ++i)
+        {
+          auto d = static_cast<std::size_t>(c_order ? ndims-1-i : i);
+          strides[d] = s;
+          s *= sizes[d];
+        }
+
+        auto inner = static_cast<std::size_t>(c_order ? ndims-1 : 0);
+        auto total = std::ptrdiff_t{1};
+        for(int i = 0; i < ndims; ++i) total *= subs[i];
+
+        for(std::ptrdiff_t r = 0; ok && total > 0 && r < total / subs[inner]; ++r)
+        {
+          std::ptrdiff_t offset = 0;
+          for(std::size_t d = 0; d < strides.size(); ++d)
+            offset += (starts[d] + index[d]) * strides[d];
+          ok = run(ts[0], offset, subs[inner], sub);
+
+          // Move to the next run of the fastest dimension
+          for(int i = 1; i < ndims; ++i)
+          {
+            auto d = static_cast<std::size_t>(c_order ? ndims-1-i : i);
+            if(++index[d] < subs[d]) break;
+            index[d] = 0;
+          }
+        }
+        break;
+      }
+
+      default:
+        ok = false;
+    }
+
+    for(auto& c : ts) release(c);
+    return ok;
+  }
+
+  // Copy blocks of a compile-time size so the copy is lowered to a few vector moves
+  template<std::ptrdiff_t L, bool Gather>
+  void copy_strided(char* dst, char const* src, std::ptrdiff_t n, std::ptrdiff_t stride) noexcept
+  {
+    for(std::ptrdiff_t i = 0; i < n; ++i)
+    {
+      if constexpr(Gather)  std::memcpy(dst + i * L, src + i * stride, L);
+      else                  std::memcpy(dst + i * stride, src + i * L, L);
+    }
+  }
+
+  template<bool Gather>
+  void copy_strided ( char* dst, char const* src, std::ptrdiff_t n, std::ptrdiff_t length
+                    , std::ptrdiff_t stride
+                    ) noexcept
+  {
+    // Dense data is copied at once
+    if(length == stride)
+    {
+      std::memcpy(dst, src, static_cast<std::size_t>(n * length));
+      return;
+    }
+
+    switch(length)
+    {
+      case  1: copy_strided< 1,Gather>(dst, src, n, stride); break;
+      case  2: copy_strided< 2,Gather>(dst, src, n, stride); break;
+      case  4: copy_strided< 4,Gather>(dst, src, n, stride); break;
+      case  8: copy_strided< 8,Gather>(dst, src, n, stride); break;
+      case 12: copy_strided<12,Gather>(dst, src, n, stride); break;
+      case 16: copy_strided<16,Gather>(dst, src, n, stride); break;
+      case 24: copy_strided<24,Gather>(dst, src, n, stride); break;
+      case 32: copy_strided<32,Gather>(dst, src, n, stride); break;
+      default:
+        auto l = static_cast<std::size_t>(length);
+        for(std::ptrdiff_t i = 0; i < n; ++i)
+        {
+          if constexpr(Gather)  std::memcpy(dst + i * length, src + i * stride, l);
+          else                  std::memcpy(dst + i * stride, src + i * length, l);
+        }
+    }
+  }
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct packer
+  //! @brief Specialized pack and unpack routines for a derived datatype
+  //!
+  //! mmm::packer decodes the type map of a `MPI_Datatype`, like the ones produced by
+  //! mmm::datatype, into a list of contiguous blocks of bytes. Adjacent blocks are merged, and
+  //! layouts made of equally sized blocks at a constant stride are copied by loops specialized for
+  //! the block size, which compilers lower to vector moves. This avoids the generic datatype
+  //! interpretation performed by `MPI_Pack` and lets strided data go out as contiguous bytes.
+  //!
+  //! @code
+  //! mmm::packer p(mmm::datatype(column));
+  //! std::vector<std::byte> buffer(p.packed_size(1));
+  //! p.pack(column.data(), 1, buffer.data());
+  //! MPI_Send(buffer.data(), static_cast<int>(buffer.size()), MPI_BYTE, peer, 0, MPI_COMM_WORLD);
+  //! @endcode
+  //!
+  //! Packed data uses the native representation, so it is only meaningful between processes with
+  //! the same data representation. Layouts that can't be decoded, like distributed arrays, are
+  //! handled by `MPI_Pack` and `MPI_Unpack`.
+  //================================================================================================
+  struct packer
+  {
+    //! @brief Build the pack and unpack routines for a committed datatype
+    //! @param t  Datatype to pack
+    explicit packer(MPI_Datatype t) : type_(t), stride_(0), native_(true)
+    {
+      MPI_Aint lb;
+      MPI_Type_get_extent(t, &lb, &extent_);
+
+      int s;
+      MPI_Type_size(t, &s);
+      size_ = s;
+
+      native_ = detail::flatten(t, 0, blocks_);
+      if(!native_) blocks_.clear();
+
+      // Regular layouts are handled as a single strided copy
+      auto regular = blocks_.size() > 1;
+      if(regular) stride_ = blocks_[1].offset - blocks_[0].offset;
+      for(std::size_t i = 1; regular && i < blocks_.size(); ++i)
+      {
+        regular =     blocks_[i].length == blocks_[0].length
+                  &&  blocks_[i].offset - blocks_[i-1].offset == stride_;
+      }
+      if(!regular) stride_ = 0;
+    }
+
+    //! Number of bytes of data in one element of the datatype
+    std::ptrdiff_t size()   const noexcept { return size_; }
+    //! Extent of one element of the datatype
+    std::ptrdiff_t extent() const noexcept { return extent_; }
+    //! Number of contiguous blocks of bytes in one element of the datatype
+    std::size_t    blocks() const noexcept { return blocks_.size(); }
+    //! Is the datatype packed by mmm or by the MPI library ?
+    bool           native() const noexcept { return native_; }
+
+    //! Number of bytes required to pack count elements
+    std::size_t packed_size(int count) const noexcept
+    {
+      if(native_) return static_cast<std::size_t>(size_ * count);
+
+      int n;
+      MPI_Pack_size(count, type_, MPI_COMM_SELF, &n);
+      return static_cast<std::size_t>(n);
+    }
+
+    //! @brief Gather count elements described by the datatype into a contiguous buffer
+    //! @param src    Buffer described by the datatype
+    //! @param count  Number of elements of the datatype to pack
+    //! @param dst    Destination buffer of at least `packed_size(count)` bytes
+    void pack(void const* src, int count, void* dst) const noexcept
+    {
+      if(!native_)
+      {
+        int position = 0;
+        auto n = static_cast<int>(packed_size(count));
+        MPI_Pack(src, count, type_, dst, n, &position, MPI_COMM_SELF);
+        return;
+      }
+
+      auto in   = static_cast<char const*>(src);
+      auto out  = static_cast<char*>(dst);
+
+      // Single blocks elements are processed all at once
+      if(blocks_.size() == 1)
+      {
+        auto b = blocks_[0];
+        detail::copy_strided<true>(out, in + b.offset, count, b.length, extent_);
+        return;
+      }
+
+      for(int e = 0; e < count; ++e, in += extent_) out = process<true>(out, in);
+    }
+
+    //! @brief Scatter contiguous data into count elements described by the datatype
+    //! @param src    Packed buffer of at least `packed_size(count)` bytes
+    //! @param dst    Buffer described by the datatype
+    //! @param count  Number of elements of the datatype to unpack
+    void unpack(void const* src, void* dst, int count) const noexcept
+    {
+      if(!native_)
+      {
+        int position = 0;
+        auto n = static_cast<int>(packed_size(count));
+        MPI_Unpack(src, n, &position, dst, count, type_, MPI_COMM_SELF);
+        return;
+      }
+
+      auto in   = static_cast<char const*>(src);
+      auto out  = static_cast<char*>(dst);
+
+      if(blocks_.size() == 1)
+      {
+        auto b = blocks_[0];
+        detail::copy_strided<false>(out + b.offset, in, count, b.length, extent_);
+        return;
+      }
+
+      for(int e = 0; e < count; ++e, out += extent_) in = process<false>(out, in);
+    }
+
+    private:
+    // Process one element, return the position following the packed data
+    template<bool Gather>
+    std::conditional_t<Gather, char*, char const*> process(char* out, char const* in) const noexcept
+    {
+      auto n      = static_cast<std::ptrdiff_t>(blocks_.size());
+
+      if(stride_ != 0)
+      {
+        auto l = blocks_[0].length;
+        auto o = blocks_[0].offset;
+        if constexpr(Gather)  detail::copy_strided<true >(out, in + o, n, l, stride_);
+        else                  detail::copy_strided<false>(out + o, in, n, l, stride_);
+      }
+      else
+      {
+        std::ptrdiff_t p = 0;
+        for(auto b : blocks_)
+        {
+          auto l = static_cast<std::size_t>(b.length);
+          if constexpr(Gather)  std::memcpy(out + p, in + b.offset, l);
+          else                  std::memcpy(out + b.offset, in + p, l);
+          p += b.length;
+        }
+      }
+
+      if constexpr(Gather)  return out + size_;
+      else                  return in + size_;
+    }
+
+    MPI_Datatype                type_;
+    std::vector<detail::block>  blocks_;
+    MPI_Aint                    extent_;
+    std::ptrdiff_t              size_;
+    std::ptrdiff_t              stride_;
+    bool                        native_;
+  };
+}
@@ -0,0 +1,195 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/kumi.hpp>
+#include <mmm/detail/request_pool.hpp>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct persistent
+  //! @brief RAII-enabled handle over a persistent communication
+  //!
+  //! mmm::persistent tracks the `MPI_Request` handles of a persistent operation. The buffer,
+  //! count, datatype, peer and tag of the operation are bound once, so that the MPI library can
+  //! skip their setup each time the operation is started. Like mmm::request, its handles are taken
+  //! from a per-thread pool.
+  //!
+  //! A persistent operation is started by start() or mmm::start_all, then completed by wait(),
+  //! test() or any of mmm::wait_all, mmm::wait_any and mmm::test_some, as many times as needed.
+  //! When destroyed, a started operation is waited for before its handles are freed.
+  //! mmm::persistent is move-only.
+  //!
+  //! @code
+  //! auto s = mmm::send_init(face, east, 0);
+  //! auto r = mmm::recv_init(halo, west, 0);
+  //!
+  //! for(int step = 0; step < steps; ++step)
+  //! {
+  //!   mmm::start_all(s, r);
+  //!   mmm::wait_all(s, r);
+  //! }
+  //! @endcode
+  //================================================================================================
+  struct persistent
+  {
+    //! Build an empty persistent operation
+    persistent() noexcept : nodes_(nullptr) {}
+
+    //! Complete the operation if it was started then free it
+    ~persistent() { release(); }
+
+    persistent(persistent const&)             = delete;
+    persistent& operator=(persistent const&)  = delete;
+
+    persistent(persistent&& other) noexcept : nodes_(std::exchange(other.nodes_, nullptr)) {}
+
+    persistent& operator=(persistent&& other) noexcept
+    {
+      persistent local(std::move(other));
+      std::swap(nodes_, local.nodes_);
+      return *this;
+    }
+
+    //! Does this instance hold an operation ?
+    explicit operator bool() const noexcept { return nodes_ != nullptr; }
+
+    //! Was the operation started and is it still pending ?
+    bool active() const noexcept
+    {
+      for(auto n = nodes_; n; n = n->next)
+      {
+        int done;
+        MPI_Request_get_status(n->handle, &done, MPI_STATUS_IGNORE);
+        if(!done) return true;
+      }
+
+      return false;
+    }
+
+    //! Handle of the first message of the operation or `nullptr` if none was built
+    MPI_Request* first() noexcept { return nodes_ ? &nodes_->handle : nullptr; }
+
+    //! Start the operation
+    void start() { for(auto n = nodes_; n; n = n->next) MPI_Start(&n->handle); }
+
+    //! Block until the operation completes and returns the status of its first message
+    MPI_Status wait()
+    {
+      MPI_Status status;
+      status.MPI_SOURCE = MPI_ANY_SOURCE;
+      status.MPI_TAG    = MPI_ANY_TAG;
+      status.MPI_ERROR  = MPI_SUCCESS;
+
+      for(auto n = nodes_; n; n = n->next)
+        MPI_Wait(&n->handle, n == nodes_ ? &status : MPI_STATUS_IGNORE);
+
+      return status;
+    }
+
+    //! @brief Check if the operation completed without blocking
+    //! @param status Optional pointer to the status of the first message to fill on completion
+    bool test(MPI_Status* status = MPI_STATUS_IGNORE)
+    {
+      bool all = true;
+      for(auto n = nodes_; n; n = n->next)
+      {
+        int done;
+        MPI_Test(&n->handle, &done, n == nodes_ ? status : MPI_STATUS_IGNORE);
+        all = all && done;
+      }
+
+      return all;
+    }
+
+    //! @brief Add a message to the operation
+    //! @return A reference to the `MPI_Request` to pass to the MPI routine building the message
+    MPI_Request& append()
+    {
+      auto node = detail::requests().acquire();
+
+      auto last = &nodes_;
+      while(*last) last = &(*last)->next;
+      *last = node;
+
+      return node->handle;
+    }
+
+    //! Call `f` on each `MPI_Request` handle of the operation
+    template<typename F> void for_each(F f)
+    {
+      for(auto n = nodes_; n; n = n->next) f(n->handle);
+    }
+
+    private:
+    void release() noexcept
+    {
+      if(!nodes_) return;
+
+      int done;
+      MPI_Finalized(&done);
+
+      if(!done)
+      {
+        for(auto n = nodes_; n; n = n->next)
+        {
+          if(n->handle == MPI_REQUEST_NULL) continue;
+          MPI_Wait(&n->handle, MPI_STATUS_IGNORE);
+          MPI_Request_free(&n->handle);
+        }
+      }
+
+      detail::requests().release(std::exchange(nodes_, nullptr));
+    }
+
+    detail::request_node* nodes_;
+  };
+
+  //================================================================================================
+  //! @brief Start several persistent operations
+  //!
+  //! All operations are started by a single call to `MPI_Startall`.
+  //!
+  //! @param ps A kumi::tuple of mmm::persistent or references to mmm::persistent
+  //================================================================================================
+  template<typename Operations>
+  requires kumi::product_type<std::remove_cvref_t<Operations>>
+  void start_all(Operations&& ps)
+  {
+    constexpr auto n = kumi::size_v<Operations>;
+
+    std::array<MPI_Request, n> handles;
+    std::size_t count = 0;
+    kumi::for_each( [&](persistent& p) { if(auto h = p.first()) handles[count++] = *h; }, ps);
+
+    MPI_Startall(static_cast<int>(count), handles.data());
+
+    count = 0;
+    kumi::for_each( [&](persistent& p) { if(auto h = p.first()) *h = handles[count++]; }, ps);
+
+    // Other messages of operations split in several messages
+    kumi::for_each( [&](persistent& p)
+                    {
+                      bool head = true;
+                      p.for_each([&](MPI_Request& h) { if(!head) MPI_Start(&h); head = false; });
+                    }
+                  , ps
+                  );
+  }
+
+  //! @overload
+  template<std::same_as<persistent>... Operations>
+  requires(sizeof...(Operations) > 0)
+  void start_all(Operations&... ps) { start_all(kumi::tie(ps...)); }
+}
@@ -0,0 +1,117 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/overload.hpp>
+#include <mmm/system/context.hpp>
+#include <mmm/system/datatype.hpp>
+#include <mmm/system/traits.hpp>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace mmm::tags
+{
+  struct reduction_ : callable<reduction_>
+  {
+    using callable<reduction_>::operator();
+
+    template<typename T>
+    auto operator()(MPI_Op op, type_t<T> const& x) const noexcept -> decltype(tag_dispatch(*this, op, x))
+    {
+      return tag_dispatch(*this, op, x);
+    }
+  };
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @var reduction
+  //! @brief reduction object function for MPI_Op retrieval
+  //!
+  //! **Defined in Header**
+  //!
+  //! @code
+  //! #include <mmm/system/reduction.hpp>
+  //! @endcode
+  //!
+  //! @groupheader{Callable Signatures}
+  //!
+  //! @code
+  //! namespace mmm
+  //! {
+  //!   template<typename T >
+  //!   MPI_Op reduction(MPI_Op op, mmm::type_t<T> target) noexcept;
+  //! }
+  //! @endcode
+  //!
+  //! **Parameters:**
+  //!
+  //!   * `op`      : A predefined MPI reduction operation like `MPI_SUM`.
+  //!   * `target`  : A [type-to-object adapter](@ref mmm::type) instance carrying the
+  //!     type of the values to reduce.
+  //!
+  //! **Return value:**
+  //!
+  //! The `MPI_Op` performing `op` over values of type `T`. For types mapped to a predefined
+  //! MPI datatype, this is `op` itself if MPI defines it for this kind of datatype, e.g `MPI_MAX`
+  //! is not defined over complex numbers nor `MPI_SUM` over `std::byte`. Types with no predefined
+  //! MPI datatype may provide a user defined operation instead, built on first use and released
+  //! when the mmm::context is destroyed. If no such operation exists, `MPI_OP_NULL` is returned.
+  //!
+  //================================================================================================
+  inline constexpr tags::reduction_ reduction = {};
+}
+
+//==================================================================================================
+// reduction specializations
+//==================================================================================================
+namespace mmm::detail
+{
+  template<typename T> inline constexpr bool is_loc_pair = false;
+
+  template<typename T>
+  inline constexpr bool is_loc_pair<std::pair<T,int>> = std::same_as<T, float>
+                                                      || std::same_as<T, double>
+                                                      || std::same_as<T, long double>
+                                                      || std::same_as<T, short>
+                                                      || std::same_as<T, int>
+                                                      || std::same_as<T, long>;
+
+  // Types mapped to a predefined MPI datatype
+  template<typename T>
+  concept predefined = std::is_arithmetic_v<T> || std::is_enum_v<T> || is_complex<T> || is_loc_pair<T>;
+
+  // Is a predefined operation defined over the predefined datatype of T ?
+  template<predefined T> bool supports(MPI_Op op) noexcept
+  {
+    auto any_of = [op](auto... ops) { return ((op == ops) || ...); };
+
+    // One-sided operations accept any predefined datatype
+    if(any_of(MPI_REPLACE, MPI_NO_OP))  return true;
+
+    if      constexpr(is_loc_pair<T>)             return any_of(MPI_MAXLOC, MPI_MINLOC);
+    else if constexpr(is_complex<T>)              return any_of(MPI_SUM, MPI_PROD);
+    else if constexpr(std::same_as<T, std::byte>) return any_of(MPI_BAND, MPI_BOR, MPI_BXOR);
+    else if constexpr(std::same_as<T, bool>)      return any_of(MPI_LAND, MPI_LOR, MPI_LXOR);
+    else if constexpr(std::floating_point<T>)     return any_of(MPI_MAX, MPI_MIN, MPI_SUM, MPI_PROD);
+    else                                          return !any_of(MPI_MAXLOC, MPI_MINLOC);
+  }
+}
+
+namespace mmm::tags
+{
+  // Types with a predefined MPI datatype use the predefined operations defined over them as is
+  template<detail::predefined T>
+  MPI_Op tag_dispatch(reduction_ const&, MPI_Op op, type_t<T> ) noexcept
+  {
+    return detail::supports<T>(op) ? op : MPI_OP_NULL;
+  }
+}
@@ -0,0 +1,166 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/request_pool.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct request
+  //! @brief RAII-enabled handle over a pending nonblocking operation
+  //!
+  //! mmm::request tracks the `MPI_Request` handles of a nonblocking operation. Those handles are
+  //! taken from a per-thread pool, so that creating, moving and destroying requests never
+  //! allocates memory in steady state. Operations split in several messages, like transfers of
+  //! more elements than an `int` can count, are tracked by a single request.
+  //!
+  //! A request still pending when destroyed is either waited for or cancelled then completed,
+  //! so that no operation is left pending when its buffers go out of scope. mmm::request is
+  //! move-only.
+  //!
+  //! @code
+  //! auto r = ctx.world().synchronize_async();
+  //! compute_interior();
+  //! r.wait();
+  //! @endcode
+  //================================================================================================
+  struct request
+  {
+    //! Policy applied to a pending operation when its request is destroyed
+    enum policy { wait_on_destroy, cancel_on_destroy };
+
+    //! Build an inactive request
+    request() noexcept : nodes_(nullptr), policy_(wait_on_destroy) {}
+
+    //! @brief Take ownership of a `MPI_Request`
+    //! @param r Request to wrap
+    //! @param p Policy applied on destruction if the operation is still pending
+    explicit request(MPI_Request r, policy p = wait_on_destroy) : request(p)
+    {
+      append() = r;
+    }
+
+    //! Build an inactive request to which handles can be appended
+    explicit request(policy p) noexcept : nodes_(nullptr), policy_(p) {}
+
+    //! Complete the pending operation if any
+    ~request() { release(); }
+
+    request(request const&)             = delete;
+    request& operator=(request const&)  = delete;
+
+    request(request&& other) noexcept
+      : nodes_(std::exchange(other.nodes_, nullptr)), policy_(other.policy_)
+    {}
+
+    request& operator=(request&& other) noexcept
+    {
+      request local(std::move(other));
+      std::swap(nodes_ , local.nodes_);
+      std::swap(policy_, local.policy_);
+      return *this;
+    }
+
+    //! Is an operation still pending on this request ?
+    bool active() const noexcept
+    {
+      for(auto n = nodes_; n; n = n->next) if(n->handle != MPI_REQUEST_NULL) return true;
+      return false;
+    }
+
+    //! Is an operation still pending on this request ?
+    explicit operator bool() const noexcept { return active(); }
+
+    //! Underlying `MPI_Request` handle of the first message of the operation
+    MPI_Request handle() const noexcept { return nodes_ ? nodes_->handle : MPI_REQUEST_NULL; }
+
+    //! Handle of the first message of the operation or `nullptr` if none was posted
+    MPI_Request* first() noexcept { return nodes_ ? &nodes_->handle : nullptr; }
+
+    //! Policy applied on destruction if the operation is still pending
+    policy      on_destroy() const noexcept { return policy_; }
+
+    //! Block until the operation completes and returns the status of its first message
+    MPI_Status wait()
+    {
+      MPI_Status status;
+      status.MPI_SOURCE = MPI_ANY_SOURCE;
+      status.MPI_TAG    = MPI_ANY_TAG;
+      status.MPI_ERROR  = MPI_SUCCESS;
+
+      for(auto n = nodes_; n; n = n->next)
+        MPI_Wait(&n->handle, n == nodes_ ? &status : MPI_STATUS_IGNORE);
+
+      return status;
+    }
+
+    //! @brief Check if the operation completed without blocking
+    //! @param status Optional pointer to the status of the first message to fill on completion
+    bool test(MPI_Status* status = MPI_STATUS_IGNORE)
+    {
+      bool all = true;
+      for(auto n = nodes_; n; n = n->next)
+      {
+        int done;
+        MPI_Test(&n->handle, &done, n == nodes_ ? status : MPI_STATUS_IGNORE);
+        all = all && done;
+      }
+
+      return all;
+    }
+
+    //! Try to cancel the pending operation. It must still be completed by wait() or test().
+    void cancel()
+    {
+      for(auto n = nodes_; n; n = n->next) if(n->handle != MPI_REQUEST_NULL) MPI_Cancel(&n->handle);
+    }
+
+    //! @brief Add a message to the operation
+    //! @return A reference to the `MPI_Request` to pass to the MPI routine posting the message
+    MPI_Request& append()
+    {
+      auto node = detail::requests().acquire();
+
+      auto last = &nodes_;
+      while(*last) last = &(*last)->next;
+      *last = node;
+
+      return node->handle;
+    }
+
+    //! Call `f` on each `MPI_Request` handle of the operation
+    template<typename F> void for_each(F f)
+    {
+      for(auto n = nodes_; n; n = n->next) f(n->handle);
+    }
+
+    private:
+    void release() noexcept
+    {
+      if(!nodes_) return;
+
+      int done;
+      MPI_Finalized(&done);
+
+      if(!done && active())
+      {
+        if(policy_ == cancel_on_destroy) cancel();
+        for(auto n = nodes_; n; n = n->next) MPI_Wait(&n->handle, MPI_STATUS_IGNORE);
+      }
+
+      detail::requests().release(std::exchange(nodes_, nullptr));
+    }
+
+    detail::request_node* nodes_;
+    policy                policy_;
+  };
+}
@@ -0,0 +1,201 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/system/datatype.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct scattered
+  //! @brief Datatype gathering blocks of elements spread over unrelated heap allocations
+  //!
+  //! mmm::scattered records the absolute address of each block of elements and builds a
+  //! `MPI_Type_create_hindexed` datatype over them. Jagged structures like a vector of vectors can
+  //! then be sent or received in a single message without packing them first in a temporary
+  //! buffer, by using `x.data()`, i.e `MPI_BOTTOM`, as buffer and a count of 1.
+  //!
+  //! As addresses are absolute, the datatype is only valid for the current allocations. It is not
+  //! cached but owned by the mmm::scattered instance and freed by its destructor. Blocks must not be
+  //! reallocated while the mmm::scattered instance is in use.
+  //!
+  //! Blocks longer than what an `int` can count are described as several consecutive blocks. If
+  //! there are more blocks than an `int` can count, no datatype is built and type() returns
+  //! `MPI_DATATYPE_NULL`.
+  //!
+  //! @code
+  //! std::vector<std::vector<int>> adjacency = build_adjacency();
+  //! mmm::scattered lists(adjacency);
+  //! MPI_Send(lists.data(), 1, mmm::datatype(lists), peer, 0, MPI_COMM_WORLD);
+  //! @endcode
+  //!
+  //! On the receiving side, inner containers are resized beforehand so that the datatype describes
+  //! where elements are to be stored.
+  //!
+  //! @tparam T     Type of the gathered elements
+  //================================================================================================
+  template<typename T>
+  struct scattered
+  {
+    //! Type of the gathered elements
+    using value_type  = T;
+
+    //! @brief Construct a datatype over the elements of a range of contiguous ranges
+    //! @param blocks Range of contiguous ranges, e.g `std::vector<std::vector<T>>`
+    template<std::ranges::input_range R>
+    requires std::ranges::contiguous_range<std::ranges::range_reference_t<R>>
+    explicit scattered(R&& blocks) : type_(MPI_DATATYPE_NULL), size_(0)
+    {
+      std::vector<MPI_Aint> addresses;
+      std::vector<int>      lengths;
+
+      for(auto&& b : blocks)
+        add_block(addresses, lengths, address_of(std::ranges::data(b)), std::ranges::size(b));
+
+      build(addresses, lengths);
+    }
+
+    //! @brief Construct a datatype over single elements
+    //! @param pointers Range of pointers to each element
+    template<std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, T*>
+    explicit scattered(R&& pointers) : type_(MPI_DATATYPE_NULL), size_(0)
+    {
+      std::vector<MPI_Aint> addresses;
+      for(T* p : pointers) addresses.push_back(address_of(p));
+      build(addresses, {});
+    }
+
+    //! @brief Construct a datatype over blocks of elements
+    //! @param pointers Pointer to the first element of each block
+    //! @param lengths  Number of elements in each block
+    scattered(std::span<T* const> pointers, std::span<int const> lengths)
+            : type_(MPI_DATATYPE_NULL), size_(0)
+    {
+      std::vector<MPI_Aint> addresses;
+      std::vector<int>      sizes;
+
+      for(std::size_t i = 0; i < pointers.size(); ++i)
+      {
+        if(lengths[i] == 0) continue;
+        addresses.push_back(address_of(pointers[i]));
+        sizes.push_back(lengths[i]);
+      }
+
+      build(addresses, sizes);
+    }
+
+    scattered(scattered const&)             = delete;
+    scattered& operator=(scattered const&)  = delete;
+
+    scattered(scattered&& other) noexcept
+            : type_(std::exchange(other.type_, MPI_DATATYPE_NULL))
+            , size_(std::exchange(other.size_, 0))
+    {}
+
+    scattered& operator=(scattered&& other) noexcept
+    {
+      scattered local(std::move(other));
+      std::swap(type_, local.type_);
+      std::swap(size_, local.size_);
+      return *this;
+    }
+
+    ~scattered()
+    {
+      int done;
+      MPI_Finalized(&done);
+      if(!done && type_ != MPI_DATATYPE_NULL) MPI_Type_free(&type_);
+    }
+
+    //! Buffer to use along the datatype, i.e `MPI_BOTTOM`
+    void*         data() const noexcept { return MPI_BOTTOM; }
+    //! Committed datatype describing all the blocks
+    MPI_Datatype  type() const noexcept { return type_; }
+    //! Total number of gathered elements
+    std::ptrdiff_t size() const noexcept { return size_; }
+
+    private:
+    static MPI_Aint address_of(T const* p) noexcept
+    {
+      MPI_Aint a;
+      MPI_Get_address(p, &a);
+      return a;
+    }
+
+    // Blocks longer than an int can count are split in several consecutive blocks
+    static void add_block ( std::vector<MPI_Aint>& addresses, std::vector<int>& lengths
+                          , MPI_Aint address, std::size_t n
+                          )
+    {
+      constexpr auto max = static_cast<std::size_t>(std::numeric_limits<int>::max());
+
+      while(n > 0)
+      {
+        auto l = std::min(n, max);
+        addresses.push_back(address);
+        lengths.push_back(static_cast<int>(l));
+        address += static_cast<MPI_Aint>(l * sizeof(T));
+        n       -= l;
+      }
+    }
+
+    void build(std::vector<MPI_Aint> const& addresses, std::vector<int> const& lengths) noexcept
+    {
+      if(!std::in_range<int>(addresses.size())) return;
+
+      auto base   = mmm::datatype(mmm::type<std::remove_cv_t<T>>);
+      auto count  = static_cast<int>(addresses.size());
+
+      // Single elements are described by hindexed_block, blocks by hindexed
+      if(lengths.empty())
+      {
+        MPI_Type_create_hindexed_block(count, 1, addresses.data(), base, &type_);
+        size_ = count;
+      }
+      else
+      {
+        MPI_Type_create_hindexed(count, lengths.data(), addresses.data(), base, &type_);
+        for(auto l : lengths) size_ += l;
+      }
+
+      MPI_Type_commit(&type_);
+    }
+
+    MPI_Datatype    type_;
+    std::ptrdiff_t  size_;
+  };
+
+  template<std::ranges::input_range R>
+  requires std::ranges::contiguous_range<std::ranges::range_reference_t<R>>
+  scattered(R&&) -> scattered < std::remove_reference_t
+                                < std::ranges::range_reference_t<std::ranges::range_reference_t<R>>
+                                >
+                              >;
+
+  template<std::ranges::input_range R>
+  requires std::is_pointer_v<std::ranges::range_value_t<R>>
+  scattered(R&&) -> scattered<std::remove_pointer_t<std::ranges::range_value_t<R>>>;
+
+  template<std::ranges::contiguous_range P, std::ranges::contiguous_range L>
+  scattered(P const&, L const&) -> scattered<std::remove_pointer_t<std::ranges::range_value_t<P>>>;
+}
+
+namespace mmm::tags
+{
+  template<typename T>
+  auto tag_dispatch(datatype_ const&, scattered<T> const& x) noexcept { return x.type(); }
+}
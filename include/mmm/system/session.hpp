@@ -0,0 +1,160 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/registry.hpp>
+#include <mmm/system/communicator.hpp>
+#include <mmm/system/context.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if MPI_VERSION >= 4
+namespace mmm
+{
+  //================================================================================================
+  //! @struct session
+  //! @brief RAII-enabled MPI session
+  //!
+  //! mmm::session is an alternative to mmm::context based on the MPI-4 Sessions model. It calls
+  //! `MPI_Session_init` instead of `MPI_Init`, so that independent components of an application
+  //! can each initialize MPI for themselves without any synchronization over `MPI_COMM_WORLD`.
+  //!
+  //! Communicators are built on demand from named process sets. The session is bound to one of
+  //! them, `mpi://WORLD` by default, which provides the same size, rank, node ID and
+  //! synchronization interface as mmm::context. Building this communicator is collective over
+  //! the processes of the process set.
+  //!
+  //! Each session owns the derived datatypes and operations built by MMM while it is the most
+  //! recently created mmm::context or mmm::session alive, and releases them when it is destroyed.
+  //! Sessions can be destroyed in any order: the registry of the most recent living one is then
+  //! used again.
+  //!
+  //! Only available if the MPI implementation supports MPI-4.
+  //!
+  //! @code
+  //! mmm::session solver;
+  //! auto local = solver.open("mpi://SELF");
+  //! solver.synchronize();
+  //! @endcode
+  //================================================================================================
+  struct session
+  {
+    //! @brief Constructor
+    //! Initialize a MPI session and build a communicator over a process set
+    //! @param pset Name of the process set the session is bound to
+    //! @param ts   Expected [thread support level](@ref thread_support)
+    explicit session(std::string const& pset = "mpi://WORLD", thread_support ts = single)
+      : handle_(MPI_SESSION_NULL)
+    {
+      MPI_Info info;
+      MPI_Info_create(&info);
+      MPI_Info_set(info, "thread_level", level_name(ts));
+      MPI_Session_init(info, MPI_ERRORS_RETURN, &handle_);
+      MPI_Info_free(&info);
+
+      detail::attach(types_);
+
+      group_  = open(pset);
+      size    = group_.size();
+      rank    = group_.rank();
+
+      int length;
+      char buffer[MPI_MAX_PROCESSOR_NAME];
+      MPI_Get_processor_name(buffer, &length);
+      node_id = std::string(&buffer[0], static_cast<std::string::size_type>(length));
+    }
+
+    //! @brief Destructor
+    //! Release all resources built by the session and finalize it
+    ~session()
+    {
+      detail::detach(types_);
+      types_.release();
+
+      group_ = communicator{};
+      MPI_Session_finalize(&handle_);
+    }
+
+    // mmm::session is non-copyable
+    session(session const&)             = delete;
+    session& operator=(session const&)  = delete;
+
+    //! @brief Build a communicator over a process set
+    //! This operation is collective over the processes of the process set.
+    //! @param pset Name of the process set
+    communicator open(std::string const& pset) const
+    {
+      MPI_Group group;
+      MPI_Group_from_session_pset(handle_, pset.c_str(), &group);
+
+      // Tags only have to be unique among concurrent calls over the same group
+      auto tag = "mmm::session::" + pset;
+
+      MPI_Comm that;
+      MPI_Comm_create_from_group(group, tag.c_str(), MPI_INFO_NULL, MPI_ERRORS_RETURN, &that);
+      MPI_Group_free(&group);
+
+      return communicator(that);
+    }
+
+    //! Names of the process sets available to the session
+    std::vector<std::string> process_sets() const
+    {
+      int n;
+      MPI_Session_get_num_psets(handle_, MPI_INFO_NULL, &n);
+
+      std::vector<std::string> names;
+      names.reserve(static_cast<std::size_t>(n));
+
+      for(int i = 0; i < n; ++i)
+      {
+        int length = 0;
+        MPI_Session_get_nth_pset(handle_, MPI_INFO_NULL, i, &length, nullptr);
+
+        std::string name(static_cast<std::size_t>(length), '\0');
+        MPI_Session_get_nth_pset(handle_, MPI_INFO_NULL, i, &length, name.data());
+        name.resize(name.find('\0') == std::string::npos ? name.size() : name.find('\0'));
+        names.push_back(std::move(name));
+      }
+
+      return names;
+    }
+
+    //! Synchronize all processes of the session's process set
+    void synchronize() const { group_.synchronize(); }
+
+    //! Communicator containing all processes of the session's process set
+    communicator const& world()   const noexcept { return group_; }
+
+    //! Underlying `MPI_Session` handle
+    MPI_Session         handle()  const noexcept { return handle_; }
+
+    //! Size of the session's process set
+    int         size;
+    //! Rank of current process in the session's process set
+    int         rank;
+    //! Node ID for current process
+    std::string node_id;
+
+    private:
+    static char const* level_name(thread_support ts) noexcept
+    {
+      if      (ts == funneled  ) return "MPI_THREAD_FUNNELED";
+      else  if(ts == serialized) return "MPI_THREAD_SERIALIZED";
+      else  if(ts == multiple  ) return "MPI_THREAD_MULTIPLE";
+      else                       return "MPI_THREAD_SINGLE";
+    }
+
+    MPI_Session       handle_;
+    detail::registry  types_;
+    communicator      group_;
+  };
+}
+#endif
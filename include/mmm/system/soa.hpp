@@ -0,0 +1,182 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/detail/kumi.hpp>
+#include <mmm/system/datatype.hpp>
+#include <mmm/system/fields.hpp>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace mmm::detail
+{
+  template<auto M, auto... Ms>
+  inline constexpr bool same_size = ((sizeof(member_type_t<Ms>) == sizeof(member_type_t<M>)) && ...);
+}
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct soa
+  //! @brief Structure of arrays destination for an incoming array of structures
+  //!
+  //! mmm::soa binds some members of a type `T` to separate destination arrays. Receiving an
+  //! array of `T` described by `mmm::datatype(mmm::type<T>, mmm::fields<Ms...>)` in a mmm::soa
+  //! with the same members stores each member in its own array, so that compute kernels get
+  //! structure of arrays data while the wire format stays an array of structures.
+  //!
+  //! If all members have the same size, mmm::soa also has an associated datatype describing the
+  //! destination arrays, so data is transposed in place by the MPI library. This datatype uses
+  //! absolute addresses and is used with `x.data()`, i.e `MPI_BOTTOM`, as buffer and a count of 1.
+  //! It is owned by the mmm::soa instance. Other cases are handled by mmm::recv through an
+  //! unpacking pass over a staging array.
+  //!
+  //! @code
+  //! std::vector<double> x(n), y(n), z(n);
+  //! mmm::soa dst(mmm::type<point>, mmm::fields<&point::x, &point::y, &point::z>, n
+  //!             , x.data(), y.data(), z.data()
+  //!             );
+  //!
+  //! MPI_Recv(dst.data(), 1, mmm::datatype(dst), peer, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+  //! @endcode
+  //!
+  //! @tparam T       Type of the incoming elements
+  //! @tparam Members Pointers to the data members of `T` to store
+  //================================================================================================
+  template<typename T, auto... Members>
+  requires(sizeof...(Members) > 0)
+  struct soa
+  {
+    //! Type of the incoming elements
+    using value_type  = T;
+    //! Tuple of pointers to each destination array
+    using arrays_type = kumi::tuple<detail::member_type_t<Members>*...>;
+
+    //! Can the destination be described by a single datatype ?
+    static constexpr bool uniform = detail::same_size<Members...>;
+
+    //! @brief Construct a structure of arrays destination
+    //! @param n      Number of elements in each array
+    //! @param arrays Pointer to the first element of each destination array
+    soa ( type_t<T>, projection<Members...>, std::size_t n
+        , detail::member_type_t<Members>*... arrays
+        )
+        : arrays_{arrays...}, size_(n), type_(MPI_DATATYPE_NULL)
+    {
+      if constexpr(uniform) type_ = make();
+    }
+
+    soa(soa const&)             = delete;
+    soa& operator=(soa const&)  = delete;
+
+    soa(soa&& other) noexcept
+      : arrays_(other.arrays_), size_(other.size_)
+      , type_(std::exchange(other.type_, MPI_DATATYPE_NULL))
+    {}
+
+    soa& operator=(soa&& other) noexcept
+    {
+      soa local(std::move(other));
+      std::swap(arrays_, local.arrays_);
+      std::swap(size_  , local.size_);
+      std::swap(type_  , local.type_);
+      return *this;
+    }
+
+    ~soa()
+    {
+      int done;
+      MPI_Finalized(&done);
+      if(!done && type_ != MPI_DATATYPE_NULL) MPI_Type_free(&type_);
+    }
+
+    //! Buffer to use along the datatype, i.e `MPI_BOTTOM`
+    void*               data()   const noexcept { return MPI_BOTTOM; }
+    //! Committed datatype describing all destination arrays
+    MPI_Datatype        type()   const noexcept requires uniform { return type_; }
+    //! Number of elements in each destination array
+    std::size_t         size()   const noexcept { return size_; }
+    //! Pointer to the first element of each destination array
+    arrays_type const&  arrays() const noexcept { return arrays_; }
+
+    private:
+    static constexpr std::size_t stride() noexcept
+    {
+      return sizeof(std::remove_pointer_t<kumi::element_t<0, arrays_type>>);
+    }
+
+    MPI_Datatype make() const noexcept
+    {
+      constexpr auto k = sizeof...(Members);
+
+      int           lengths[k];
+      MPI_Aint      offsets[k];
+      MPI_Datatype  types[k];
+
+      kumi::for_each_index( [&](auto i, auto p)
+                            {
+                              using type = std::remove_cvref_t<decltype(*p)>;
+                              lengths[i] = 1;
+                              MPI_Get_address(p, &offsets[i]);
+                              types[i]   = mmm::datatype(mmm::type<type>);
+                            }
+                          , arrays_
+                          );
+
+      // Each element of the datatype covers one member of every array, then moves to the next one
+      MPI_Datatype element, resized, that;
+      MPI_Type_create_struct(static_cast<int>(k), lengths, offsets, types, &element);
+      MPI_Type_create_resized(element, 0, static_cast<MPI_Aint>(stride()), &resized);
+      MPI_Type_contiguous(static_cast<int>(size_), resized, &that);
+      MPI_Type_commit(&that);
+
+      MPI_Type_free(&element);
+      MPI_Type_free(&resized);
+      return that;
+    }
+
+    arrays_type   arrays_;
+    std::size_t   size_;
+    MPI_Datatype  type_;
+  };
+
+  template<typename T, auto... Ms, typename... Ps>
+  soa(type_t<T>, projection<Ms...>, std::size_t, Ps*...) -> soa<T, Ms...>;
+}
+
+//==================================================================================================
+// soa support
+//==================================================================================================
+namespace mmm::detail
+{
+  // Scatter the selected members of n elements of T into the destination arrays
+  template<typename T, auto... Ms>
+  void transpose(T const* in, std::size_t n, soa<T,Ms...> const& dst) noexcept
+  {
+    kumi::for_each( [&](auto p, auto m)
+                    {
+                      for(std::size_t i = 0; i < n; ++i)
+                      {
+                        auto src = std::addressof(in[i].*(decltype(m)::value));
+                        std::memcpy(p + i, src, sizeof(*p));
+                      }
+                    }
+                  , dst.arrays(), kumi::tuple<std::integral_constant<decltype(Ms), Ms>...>{}
+                  );
+  }
+}
+
+namespace mmm::tags
+{
+  template<typename T, auto... Ms>
+  requires soa<T,Ms...>::uniform
+  auto tag_dispatch(datatype_ const&, soa<T,Ms...> const& x) noexcept { return x.type(); }
+}
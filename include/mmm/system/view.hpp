@@ -0,0 +1,215 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <mpi.h>
+#include <mmm/system/datatype.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace mmm
+{
+  //================================================================================================
+  //! @struct view
+  //! @brief Non-owning strided view over a multi-dimensional block of memory
+  //!
+  //! mmm::view describes a block of `Rank` dimensions with its extents and strides, both expressed
+  //! in number of elements like `std::mdspan` does. Passing a view to mmm::datatype gives a
+  //! cached `MPI_Datatype` describing its layout, so that matrix columns, tiles or halo faces can
+  //! be sent straight from their storage by using `v.data()` as buffer and a count of 1.
+  //!
+  //! Strides too large for an `int` are described in bytes. Views with an extent larger than
+  //! what an `int` can count have no datatype: mmm::datatype returns `MPI_DATATYPE_NULL` for them.
+  //!
+  //! @code
+  //! double grid[64][64][64];
+  //! mmm::view g(&grid[0][0][0], {64,64,64});
+  //!
+  //! // Face at z = 63
+  //! auto face = g.subview({0,0,63}, {64,64,1});
+  //! MPI_Send(face.data(), 1, mmm::datatype(face), peer, 0, MPI_COMM_WORLD);
+  //! @endcode
+  //!
+  //! @tparam T     Type of the viewed elements
+  //! @tparam Rank  Number of dimensions of the view
+  //================================================================================================
+  template<typename T, std::size_t Rank>
+  struct view
+  {
+    static_assert(Rank > 0, "[MMM] - mmm::view must have at least one dimension");
+
+    //! Type of the viewed elements
+    using value_type  = T;
+    //! Type of the extents and strides
+    using shape_type  = std::array<std::ptrdiff_t, Rank>;
+
+    //! @brief Construct a view over a row-major block
+    //! @param data     Pointer to the first element of the block
+    //! @param extents  Number of elements along each dimension
+    constexpr view(T* data, shape_type const& extents) noexcept
+            : data_(data), extents_(extents), strides_{}
+    {
+      std::ptrdiff_t s = 1;
+      for(std::size_t i = Rank; i-- > 0;)
+      {
+        strides_[i] = s;
+        s *= extents_[i];
+      }
+    }
+
+    //! @brief Construct a view over a block with arbitrary strides
+    //! @param data     Pointer to the first element of the block
+    //! @param extents  Number of elements along each dimension
+    //! @param strides  Distance in elements between two consecutive elements of each dimension
+    constexpr view(T* data, shape_type const& extents, shape_type const& strides) noexcept
+            : data_(data), extents_(extents), strides_(strides)
+    {}
+
+    //! @brief Build a view over a sub-block of current view
+    //! @param offsets  Position of the sub-block first element along each dimension
+    //! @param extents  Number of elements of the sub-block along each dimension
+    constexpr view subview(shape_type const& offsets, shape_type const& extents) const noexcept
+    {
+      T* p = data_;
+      for(std::size_t i = 0; i < Rank; ++i) p += offsets[i] * strides_[i];
+      return view(p, extents, strides_);
+    }
+
+    //! Pointer to the first element of the view
+    constexpr T*                data()    const noexcept { return data_; }
+    //! Number of elements along each dimension
+    constexpr shape_type const& extents() const noexcept { return extents_; }
+    //! Distance in elements between two consecutive elements of each dimension
+    constexpr shape_type const& strides() const noexcept { return strides_; }
+    //! Number of dimensions
+    static constexpr std::size_t rank()   noexcept { return Rank; }
+
+    //! Total number of elements in the view
+    constexpr std::ptrdiff_t size() const noexcept
+    {
+      std::ptrdiff_t n = 1;
+      for(auto e : extents_) n *= e;
+      return n;
+    }
+
+    private:
+    T*          data_;
+    shape_type  extents_;
+    shape_type  strides_;
+  };
+
+  template<typename T, std::size_t Rank>
+  view(T*, std::ptrdiff_t const(&)[Rank]) -> view<T,Rank>;
+
+  template<typename T, std::size_t Rank>
+  view(T*, std::ptrdiff_t const(&)[Rank], std::ptrdiff_t const(&)[Rank]) -> view<T,Rank>;
+}
+
+//==================================================================================================
+// view datatype support
+//==================================================================================================
+namespace mmm::detail
+{
+  // Can the view be described as a sub-block of a row-major array ?
+  template<typename T, std::size_t Rank>
+  constexpr bool is_subarray(view<T,Rank> const& v) noexcept
+  {
+    auto const& e = v.extents();
+    auto const& s = v.strides();
+
+    if(s[Rank-1] != 1) return false;
+    for(std::size_t i = 0; i+1 < Rank; ++i)
+    {
+      if(s[i+1] == 0 || s[i] % s[i+1] != 0 || s[i] / s[i+1] < e[i+1]) return false;
+    }
+
+    return true;
+  }
+
+  template<typename T, std::size_t Rank>
+  MPI_Datatype make_view(view<T,Rank> const& v) noexcept
+  {
+    auto const& e = v.extents();
+    auto const& s = v.strides();
+    auto        base = mmm::datatype(mmm::type<std::remove_cv_t<T>>);
+    auto        fits = [](std::ptrdiff_t n) { return std::in_range<int>(n); };
+    auto        size = static_cast<std::ptrdiff_t>(sizeof(T));
+    MPI_Datatype that;
+
+    if(!std::ranges::all_of(e, fits)) return MPI_DATATYPE_NULL;
+
+    if(v.size() == 0)
+    {
+      MPI_Type_contiguous(0, base, &that);
+    }
+    else if constexpr(Rank == 1)
+    {
+      auto n      = static_cast<int>(e[0]);
+      auto stride = static_cast<MPI_Aint>(s[0] * size);
+      if(s[0] == 1)       MPI_Type_contiguous(n, base, &that);
+      else if(fits(s[0])) MPI_Type_vector(n, 1, static_cast<int>(s[0]), base, &that);
+      else                MPI_Type_create_hvector(n, 1, stride, base, &that);
+    }
+    else if(is_subarray(v) && std::ranges::all_of(s, fits))
+    {
+      if constexpr(Rank == 2)
+      {
+        MPI_Type_vector ( static_cast<int>(e[0]), static_cast<int>(e[1]), static_cast<int>(s[0])
+                        , base, &that
+                        );
+      }
+      else
+      {
+        int sizes[Rank], subsizes[Rank], starts[Rank];
+        for(std::size_t i = 0; i < Rank; ++i)
+        {
+          sizes[i]    = static_cast<int>(i == 0 ? e[0] : s[i-1] / s[i]);
+          subsizes[i] = static_cast<int>(e[i]);
+          starts[i]   = 0;
+        }
+
+        MPI_Type_create_subarray( static_cast<int>(Rank), sizes, subsizes, starts, MPI_ORDER_C
+                                , base, &that
+                                );
+      }
+    }
+    else
+    {
+      // Arbitrary or large strides: nest one hvector per dimension starting from the innermost one
+      that = base;
+      for(std::size_t i = Rank; i-- > 0;)
+      {
+        MPI_Datatype outer;
+        auto stride = static_cast<MPI_Aint>(s[i] * size);
+        MPI_Type_create_hvector(static_cast<int>(e[i]), 1, stride, that, &outer);
+        if(that != base) MPI_Type_free(&that);
+        that = outer;
+      }
+    }
+
+    return that;
+  }
+}
+
+namespace mmm::tags
+{
+  template<typename T, std::size_t Rank>
+  requires detail::has_datatype<std::remove_cv_t<T>>
+  auto tag_dispatch(datatype_ const&, view<T,Rank> const& v) noexcept
+  {
+    auto const& e = v.extents();
+    auto const& s = v.strides();
+
+    return detail::types().get<view<T,Rank>>( detail::hash_pattern(e, s)
+                                            , [&]() { return detail::make_view(v); }
+                                            , e, s
+                                            );
+  }
+}
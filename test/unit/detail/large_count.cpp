@@ -0,0 +1,125 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/detail/large_count.hpp>
+#include <numeric>
+#include <vector>
+
+// Small chunks let us exercise the chunked code paths without allocating gigabytes
+inline constexpr std::size_t small_chunk = 64;
+
+TTS_CASE("Check chunk count computation")
+{
+#if defined(MMM_HAS_LARGE_COUNT)
+  TTS_EQUAL(mmm::detail::chunk_count(std::size_t{1} << 33), 1ULL);
+#else
+  TTS_EQUAL(mmm::detail::chunk_count(0)                     , 1ULL);
+  TTS_EQUAL(mmm::detail::chunk_count(INT_MAX)               , 2ULL);
+  TTS_EQUAL(mmm::detail::chunk_count(std::size_t{1} << 33)  , 9ULL);
+  TTS_EQUAL(mmm::detail::chunk_count(63 , small_chunk)      , 1ULL);
+  TTS_EQUAL(mmm::detail::chunk_count(64 , small_chunk)      , 2ULL);
+  TTS_EQUAL(mmm::detail::chunk_count(65 , small_chunk)      , 2ULL);
+  TTS_EQUAL(mmm::detail::chunk_count(639, small_chunk)      , 10ULL);
+  TTS_EQUAL(mmm::detail::chunk_count(640, small_chunk)      , 11ULL);
+#endif
+};
+
+TTS_CASE("Check chunked blocking point-to-point transfers")
+{
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  int const peer = size > 1 ? 1 : 0;
+  std::vector<int> data(1000), out(1000, -1);
+  std::iota(data.begin(), data.end(), 0);
+
+  if(rank == 0)
+    mmm::detail::send(data.data(), data.size(), MPI_INT, peer, 7, MPI_COMM_WORLD, small_chunk);
+
+  // Results are checked on the receiver then shared so every process reports them
+  int ok[4] = {};
+  if(rank == peer)
+  {
+    MPI_Status status;
+    mmm::detail::recv ( out.data(), out.size(), MPI_INT, MPI_ANY_SOURCE, MPI_ANY_TAG
+                      , MPI_COMM_WORLD, &status, small_chunk
+                      );
+
+    int count;
+    MPI_Get_count(&status, MPI_INT, &count);
+    ok[0] = out == data;
+    ok[1] = count;
+    ok[2] = status.MPI_TAG;
+    ok[3] = status.MPI_SOURCE;
+  }
+
+  MPI_Bcast(ok, 4, MPI_INT, peer, MPI_COMM_WORLD);
+  TTS_EXPECT(ok[0]);
+  TTS_EQUAL(ok[1], 1000);
+  TTS_EQUAL(ok[2], 7   );
+  TTS_EQUAL(ok[3], 0   );
+};
+
+TTS_CASE("Check chunked nonblocking point-to-point transfers")
+{
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  int const next = (rank + 1) % size;
+  int const prev = (rank + size - 1) % size;
+
+  std::vector<double> data(300), out(300);
+  std::iota(data.begin(), data.end(), 100. * rank);
+
+  auto n = mmm::detail::chunk_count(data.size(), small_chunk);
+  std::vector<MPI_Request> reqs(2*n);
+
+  mmm::detail::irecv( out.data() , out.size() , MPI_DOUBLE, prev, 3, MPI_COMM_WORLD, reqs.data()
+                    , small_chunk
+                    );
+  mmm::detail::isend( data.data(), data.size(), MPI_DOUBLE, next, 3, MPI_COMM_WORLD, reqs.data()+n
+                    , small_chunk
+                    );
+  MPI_Waitall(static_cast<int>(reqs.size()), reqs.data(), MPI_STATUSES_IGNORE);
+
+  std::vector<double> expected(300);
+  std::iota(expected.begin(), expected.end(), 100. * prev);
+  TTS_EQUAL(out, expected);
+};
+
+TTS_CASE("Check chunked collectives")
+{
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  std::vector<long> data(500);
+  if(rank == 0) std::iota(data.begin(), data.end(), 0L);
+
+  mmm::detail::bcast(data.data(), data.size(), MPI_LONG, 0, MPI_COMM_WORLD, small_chunk);
+
+  std::vector<long> expected(500);
+  std::iota(expected.begin(), expected.end(), 0L);
+  TTS_EQUAL(data, expected);
+
+  std::vector<long> sum(500);
+  mmm::detail::allreduce( data.data(), sum.data(), data.size(), MPI_LONG, MPI_SUM, MPI_COMM_WORLD
+                        , small_chunk
+                        );
+
+  for(auto& e : expected) e *= size;
+  TTS_EQUAL(sum, expected);
+
+  mmm::detail::allreduce( MPI_IN_PLACE, data.data(), data.size(), MPI_LONG, MPI_MAX, MPI_COMM_WORLD
+                        , small_chunk
+                        );
+  std::iota(expected.begin(), expected.end(), 0L);
+  TTS_EQUAL(data, expected);
+};
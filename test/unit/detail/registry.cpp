@@ -0,0 +1,136 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <array>
+#include <vector>
+
+namespace
+{
+  struct point { double x, y; int id; };
+
+  MPI_Datatype make_pair_type()
+  {
+    MPI_Datatype t;
+    MPI_Type_contiguous(2, MPI_INT, &t);
+    return t;
+  }
+}
+
+TTS_CASE("Check mmm::detail::type_id")
+{
+  auto a = mmm::detail::type_id<point>;
+  auto b = mmm::detail::type_id<point, int>;
+
+  TTS_NOT_EQUAL(a, b);
+  TTS_EQUAL(a, mmm::detail::type_id<point>);
+  TTS_EXPECT(a < mmm::detail::type_counter().load());
+};
+
+TTS_CASE("Check mmm::detail::registry lookup")
+{
+  mmm::detail::registry r;
+  int built = 0;
+  auto build = [&]() { ++built; return make_pair_type(); };
+
+  auto t0 = r.get<point>(build);
+  auto t1 = r.get<point>(build);
+  auto t2 = r.get<point, int>(build);
+
+  TTS_EQUAL(built, 2);
+  TTS_EQUAL(t0, t1);
+  TTS_NOT_EQUAL(t0, t2);
+
+  int size;
+  MPI_Type_size(t0, &size);
+  TTS_EQUAL(size, static_cast<int>(2*sizeof(int)));
+
+  r.release();
+  r.get<point>(build);
+  TTS_EQUAL(built, 3);
+};
+
+TTS_CASE("Check mmm::detail::registry pattern lookup")
+{
+  mmm::detail::registry r;
+  int built = 0;
+  auto build = [&]() { ++built; return make_pair_type(); };
+
+  std::array<int, 2>          a = {1, 2};
+  std::vector<std::ptrdiff_t> b = {1, 2}, c = {2, 1};
+
+  auto t0 = r.get<point>(mmm::detail::hash_pattern(a), build, a);
+  auto t1 = r.get<point>(mmm::detail::hash_pattern(b), build, b);
+  auto t2 = r.get<point>(mmm::detail::hash_pattern(c), build, c);
+  auto t3 = r.get<int>  (mmm::detail::hash_pattern(a), build, a);
+
+  TTS_EQUAL(built, 3);
+  TTS_EQUAL(t0, t1);
+  TTS_NOT_EQUAL(t0, t2);
+  TTS_NOT_EQUAL(t0, t3);
+
+  r.release();
+  r.get<point>(mmm::detail::hash_pattern(a), build, a);
+  TTS_EQUAL(built, 4);
+};
+
+TTS_CASE("Check mmm::detail::registry operations")
+{
+  mmm::detail::registry r;
+  int built = 0;
+  auto build = [&]()
+  {
+    ++built;
+    MPI_Op o;
+    MPI_Op_create([](void*, void*, int*, MPI_Datatype*) {}, 1, &o);
+    return o;
+  };
+
+  auto o0 = r.operation<point>(build);
+  auto o1 = r.operation<point>(build);
+  auto o2 = r.operation<point, int>(build);
+
+  TTS_EQUAL(built, 2);
+  TTS_EQUAL(o0, o1);
+  TTS_NOT_EQUAL(o0, o2);
+
+  r.release();
+  r.operation<point>(build);
+  TTS_EQUAL(built, 3);
+};
+
+TTS_CASE("Check mmm::detail::registry attachment")
+{
+  auto& context = mmm::detail::types();
+
+  {
+    mmm::detail::registry a, b;
+    mmm::detail::attach(a);
+    mmm::detail::attach(b);
+    TTS_EQUAL(&mmm::detail::types(), &b);
+
+    // Detaching out of order keeps the most recent living registry active
+    mmm::detail::detach(a);
+    TTS_EQUAL(&mmm::detail::types(), &b);
+
+    auto t = mmm::datatype(mmm::type<point>);
+    TTS_EQUAL(t, b.get<point>([]() { return MPI_DATATYPE_NULL; }));
+
+    mmm::detail::detach(b);
+  }
+
+  TTS_EQUAL(&mmm::detail::types(), &context);
+};
+
+TTS_CASE("Check mmm::datatype uses the context registry")
+{
+  auto t = mmm::datatype(mmm::type<point>);
+
+  TTS_EQUAL(t, mmm::datatype(mmm::type<point>));
+  TTS_EQUAL(t, mmm::detail::types().get<point>([]() { return MPI_DATATYPE_NULL; }));
+};
@@ -0,0 +1,181 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <optional>
+#include <vector>
+
+namespace
+{
+  int rank()
+  {
+    int r;
+    MPI_Comm_rank(MPI_COMM_WORLD, &r);
+    return r;
+  }
+
+  int size()
+  {
+    int s;
+    MPI_Comm_size(MPI_COMM_WORLD, &s);
+    return s;
+  }
+
+  int next()      { return (rank() + 1) % size(); }
+  int previous()  { return (rank() + size() - 1) % size(); }
+}
+
+TTS_CASE("Check mmm::wait_all over heterogeneous requests")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+
+  int                 i = -1, me = rank();
+  std::vector<double> d(8);
+  std::vector<double> values(8, 0.25 * rank());
+
+  auto ri = mmm::irecv(i, previous(), 1);
+  auto rd = mmm::irecv[mmm::from = previous()][mmm::tag = 2](d);
+  auto si = mmm::isend(me, next(), 1);
+  auto sd = mmm::isend(values, next(), 2);
+  auto b  = world.synchronize_async();
+
+  auto status = mmm::wait_all(kumi::tie(ri, rd, si, sd, b));
+
+  TTS_EQUAL(status[0].MPI_SOURCE, previous());
+  TTS_EQUAL(status[1].MPI_TAG, 2);
+  TTS_EQUAL(i, previous());
+  TTS_EQUAL(d, std::vector<double>(8, 0.25 * previous()));
+
+  TTS_EXPECT_NOT(ri.active());
+  TTS_EXPECT_NOT(rd.active());
+  TTS_EXPECT_NOT(si.active());
+  TTS_EXPECT_NOT(sd.active());
+  TTS_EXPECT_NOT(b.active());
+};
+
+TTS_CASE("Check mmm::wait_any")
+{
+  int never = -1, value = -1, mine = rank() + 100;
+
+  auto pending  = mmm::irecv[mmm::from = rank()][mmm::tag = 98][mmm::cancel_on_destroy](never);
+  auto r        = mmm::irecv(value, previous(), 3);
+  auto s        = mmm::isend(mine, next(), 3);
+
+  auto [index, status] = mmm::wait_any(pending, r);
+
+  TTS_EQUAL(index, 1ULL);
+  TTS_EQUAL(status.MPI_SOURCE, previous());
+  TTS_EQUAL(value, previous() + 100);
+  TTS_EXPECT(pending.active());
+  TTS_EXPECT_NOT(r.active());
+
+  mmm::request none;
+  auto [nothing, _] = mmm::wait_any(none);
+  TTS_EQUAL(nothing, 1ULL);
+
+  s.wait();
+};
+
+TTS_CASE("Check mmm::test_some")
+{
+  int never = -1, value = -1, mine = rank();
+
+  auto pending  = mmm::irecv[mmm::from = rank()][mmm::tag = 97][mmm::cancel_on_destroy](never);
+  auto r        = mmm::irecv(value, previous(), 4);
+  auto s        = mmm::isend(mine, next(), 4);
+
+  bool received = false, sent = false;
+  while(!received || !sent)
+  {
+    auto done = mmm::test_some(kumi::tie(pending, r, s));
+    TTS_EXPECT_NOT(done[0].has_value());
+    received  = received || done[1].has_value();
+    sent      = sent     || done[2].has_value();
+  }
+
+  TTS_EQUAL(value, previous());
+  TTS_EXPECT(pending.active());
+};
+
+namespace
+{
+  // Receive two messages with tags t and t + 1 from previous() as a single operation
+  mmm::request split_recv(int (&in)[2], int t)
+  {
+    mmm::request r(mmm::request::wait_on_destroy);
+    MPI_Irecv(&in[0], 1, MPI_INT, previous(), t    , MPI_COMM_WORLD, &r.append());
+    MPI_Irecv(&in[1], 1, MPI_INT, previous(), t + 1, MPI_COMM_WORLD, &r.append());
+    return r;
+  }
+}
+
+TTS_CASE("Check mmm::wait_all and mmm::wait_any over operations made of several messages")
+{
+  int in[2] = { -1, -1 }, other[2] = { -1, -1 }, out[2] = { rank(), rank() + 10 };
+  int never = -1;
+
+  auto pending  = mmm::irecv[mmm::from = rank()][mmm::tag = 96][mmm::cancel_on_destroy](never);
+  auto r        = split_recv(in, 20);
+  auto o        = split_recv(other, 22);
+  auto s        = mmm::isend(out[0], next(), 20);
+  auto t        = mmm::isend(out[1], next(), 21);
+
+  auto [index, status] = mmm::wait_any(pending, r);
+  TTS_EQUAL(index, 1ULL);
+  TTS_EQUAL(status.MPI_SOURCE, previous());
+  TTS_EXPECT_NOT(r.active());
+  TTS_EXPECT(pending.active());
+  TTS_EQUAL(in[0], previous());
+  TTS_EQUAL(in[1], previous() + 10);
+
+  auto u = mmm::isend(out[0], next(), 22);
+  auto v = mmm::isend(out[1], next(), 23);
+
+  auto all = mmm::wait_all(o, s, t, u, v);
+  TTS_EQUAL(all[0].MPI_SOURCE, previous());
+  TTS_EQUAL(all[0].MPI_TAG, 22);
+  TTS_EXPECT_NOT(o.active());
+  TTS_EQUAL(other[0], previous());
+  TTS_EQUAL(other[1], previous() + 10);
+};
+
+TTS_CASE("Check mmm::test_some over operations made of several messages")
+{
+  int in[2] = { -1, -1 }, out[2] = { rank(), rank() + 10 };
+
+  // The first message is sent once the second one was received: the operation can't complete
+  auto r = split_recv(in, 30);
+  auto s = mmm::isend(out[1], next(), 31);
+
+  // Number of messages of r still pending
+  auto pending = [&]()
+  {
+    int k = 0;
+    r.for_each([&](MPI_Request& h) { if(h != MPI_REQUEST_NULL) ++k; });
+    return k;
+  };
+
+  while(pending() == 2)
+  {
+    auto done = mmm::test_some(r);
+    TTS_EXPECT_NOT(done[0].has_value());
+  }
+  TTS_EXPECT(r.active());
+  TTS_EQUAL(in[1], previous() + 10);
+
+  auto t = mmm::isend(out[0], next(), 30);
+
+  std::optional<MPI_Status> status;
+  while(!status) status = mmm::test_some(r)[0];
+
+  TTS_EQUAL(status->MPI_SOURCE, previous());
+  TTS_EQUAL(status->MPI_TAG, 30);
+  TTS_EQUAL(in[0], previous());
+  TTS_EXPECT_NOT(r.active());
+  mmm::wait_all(s, t);
+};
@@ -0,0 +1,205 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <array>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+  struct sample { double v; int id; char c; };
+
+  int rank()
+  {
+    int r;
+    MPI_Comm_rank(MPI_COMM_WORLD, &r);
+    return r;
+  }
+
+  // Each rank sends to its successor and receives from its predecessor
+  int next()
+  {
+    int r, s;
+    MPI_Comm_rank(MPI_COMM_WORLD, &r);
+    MPI_Comm_size(MPI_COMM_WORLD, &s);
+    return (r+1) % s;
+  }
+
+  int previous()
+  {
+    int r, s;
+    MPI_Comm_rank(MPI_COMM_WORLD, &r);
+    MPI_Comm_size(MPI_COMM_WORLD, &s);
+    return (r+s-1) % s;
+  }
+}
+
+TTS_CASE("Check mmm::send/recv over single values")
+{
+  mmm::send(rank() * 10, next(), 1);
+  mmm::send(sample{2.5, rank(), 'z'}, next(), 2);
+
+  int i = 0;
+  auto st = mmm::recv(i, previous(), 1);
+  auto s  = mmm::recv(mmm::type<sample>, MPI_ANY_SOURCE, 2);
+
+  TTS_EQUAL(i, previous() * 10);
+  TTS_EQUAL(st.MPI_SOURCE, previous());
+  TTS_EQUAL(st.MPI_TAG   , 1);
+  TTS_EQUAL(s.v , 2.5);
+  TTS_EQUAL(s.id, previous());
+  TTS_EQUAL(s.c , 'z');
+};
+
+TTS_CASE("Check mmm::send/recv over contiguous containers")
+{
+  auto sz = static_cast<std::size_t>(3 + rank());
+
+  mmm::send(std::vector<double>(sz, 0.5)      , next(), 3);
+  mmm::send("rank " + std::to_string(rank())  , next(), 4);
+  mmm::send(std::array<int,3>{rank(),2,3}     , next(), 5);
+
+  std::vector<double> v(10, 9.);
+  std::string         t;
+  std::array<int,3>   a = {};
+  std::span<int>      s(a);
+
+  auto st = mmm::recv(v, previous(), 3);
+  mmm::recv(t, previous(), 4);
+  mmm::recv(s, previous(), 5);
+
+  int count;
+  MPI_Get_count(&st, MPI_DOUBLE, &count);
+
+  TTS_EQUAL(count, 3 + previous());
+  TTS_EQUAL(v, std::vector<double>(static_cast<std::size_t>(3 + previous()), 0.5));
+  TTS_EQUAL(t, "rank " + std::to_string(previous()));
+  TTS_EQUAL(a, (std::array<int,3>{previous(),2,3}));
+};
+
+TTS_CASE("Check mmm::send/recv over nested containers")
+{
+  std::vector<std::vector<int>> jagged = { {rank(),1,2}, {}, {3}, {4,5,6,7} };
+  std::vector<std::string>      words  = { "alpha", "", "gamma" };
+  std::vector<std::vector<std::vector<sample>>> deep = { { {{1.,rank(),'a'}} , {} }
+                                                       , { {{2.,1,'b'}, {3.,2,'c'}} }
+                                                       };
+
+  mmm::send(jagged, next(), 6);
+  mmm::send(words , next(), 7);
+  mmm::send(deep  , next(), 8);
+
+  std::vector<std::vector<int>> j = { {9,9} };
+  auto w = mmm::recv(mmm::type<std::vector<std::string>>, previous(), 7);
+  mmm::recv(j, previous(), 6);
+  auto d = mmm::recv(mmm::type<std::vector<std::vector<std::vector<sample>>>>, previous(), 8);
+
+  TTS_EQUAL(j, (std::vector<std::vector<int>>{ {previous(),1,2}, {}, {3}, {4,5,6,7} }));
+  TTS_EQUAL(w, words);
+
+  TTS_EQUAL(d.size()      , 2ULL);
+  TTS_EQUAL(d[0].size()   , 2ULL);
+  TTS_EQUAL(d[0][1].size(), 0ULL);
+  TTS_EQUAL(d[0][0][0].id , previous());
+  TTS_EQUAL(d[1][0][1].v  , 3.);
+  TTS_EQUAL(d[1][0][1].c  , 'c');
+};
+
+TTS_CASE("Check resizable receives of chunked flat messages")
+{
+#if !defined(MMM_HAS_LARGE_COUNT)
+  // Small chunks let us exercise the chunked code paths without allocating gigabytes
+  constexpr std::size_t chunk = 64;
+
+  // Exact multiples of the chunk size end with an empty chunk
+  for(std::size_t n : {std::size_t{63}, std::size_t{640}, std::size_t{1000}})
+  {
+    std::vector<int> data(n);
+    for(std::size_t i = 0; i < n; ++i) data[i] = static_cast<int>(i) + rank();
+
+    mmm::detail::send(data.data(), n, MPI_INT, next(), 9, MPI_COMM_WORLD, chunk);
+    mmm::send(-1, next(), 9);
+
+    std::vector<int> out;
+    MPI_Status status;
+    auto e = mmm::detail::recv_resized(out, MPI_ANY_SOURCE, 9, MPI_COMM_WORLD, &status, chunk);
+
+    int count, last;
+    MPI_Get_count(&status, MPI_INT, &count);
+    mmm::recv(last, previous(), 9);
+
+    TTS_EQUAL(e                 , MPI_SUCCESS);
+    TTS_EQUAL(out.size()        , n);
+    TTS_EQUAL(out.back()        , static_cast<int>(n) - 1 + previous());
+    TTS_EQUAL(count             , static_cast<int>(n));
+    TTS_EQUAL(status.MPI_SOURCE , previous());
+    TTS_EQUAL(last              , -1);
+  }
+#else
+  TTS_PASS("Large count transfers are not chunked");
+#endif
+};
+
+TTS_CASE("Check chunked nonblocking messages post one request per chunk")
+{
+  // Each chunk handed to the posting callback gets a single request
+  std::vector<std::size_t> sizes;
+  mmm::request r;
+  char buffer[128];
+  mmm::detail::post_chunks( buffer, 128, MPI_CHAR, r
+                          , [&](char*, std::size_t n, MPI_Request* q)
+                            {
+                              sizes.push_back(n);
+                              *q = MPI_REQUEST_NULL;
+                            }
+                          , 64
+                          );
+
+#if !defined(MMM_HAS_LARGE_COUNT)
+  TTS_EQUAL(sizes, (std::vector<std::size_t>{64, 64, 0}));
+#else
+  TTS_EQUAL(sizes, (std::vector<std::size_t>{128}));
+#endif
+
+  // Transfers with MPI_PROC_NULL never touch their buffer, which is thus left uncommitted
+  constexpr auto chunk = mmm::detail::chunk_size;
+  for(std::size_t n : {chunk - 1, chunk, 2 * chunk + 5})
+  {
+    std::unique_ptr<char[]> data(new char[n]);
+    std::span<char>         view(data.get(), n);
+
+    auto s = mmm::isend(view, MPI_PROC_NULL, 0);
+    auto q = mmm::irecv(view, MPI_PROC_NULL, 0);
+
+    std::size_t sends = 0, recvs = 0;
+    s.for_each([&](MPI_Request&) { ++sends; });
+    q.for_each([&](MPI_Request&) { ++recvs; });
+
+    TTS_EQUAL(sends, mmm::detail::chunk_count(n));
+    TTS_EQUAL(recvs, mmm::detail::chunk_count(n));
+
+    s.wait();
+    q.wait();
+    TTS_EXPECT_NOT(s.active());
+    TTS_EXPECT_NOT(q.active());
+  }
+};
+
+TTS_CASE("Check mmm::recv reports errors in its status")
+{
+  mmm::send(std::vector<std::string>{"a", "bc"}, next(), 10);
+
+  std::vector<std::string> w;
+  auto st = mmm::recv(w, previous(), 10);
+
+  TTS_EQUAL(st.MPI_ERROR, MPI_SUCCESS);
+  TTS_EQUAL(st.MPI_SOURCE, previous());
+};
@@ -0,0 +1,87 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+  int rank()
+  {
+    int r;
+    MPI_Comm_rank(MPI_COMM_WORLD, &r);
+    return r;
+  }
+
+  int size()
+  {
+    int s;
+    MPI_Comm_size(MPI_COMM_WORLD, &s);
+    return s;
+  }
+
+  int next()      { return (rank() + 1) % size(); }
+  int previous()  { return (rank() + size() - 1) % size(); }
+}
+
+TTS_CASE("Check mmm::send/recv with options on values")
+{
+  mmm::send[mmm::to = next()][mmm::tag = 3](rank() * 10);
+
+  int i = -1;
+  auto st = mmm::recv[mmm::from = previous()][mmm::tag = 3](i);
+
+  TTS_EQUAL(i, previous() * 10);
+  TTS_EQUAL(st.MPI_SOURCE, previous());
+  TTS_EQUAL(st.MPI_TAG, 3);
+};
+
+TTS_CASE("Check mmm::send/recv with options on ranges")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  auto c = world.dup();
+
+  std::vector<double> values(5, 1.5 * rank());
+  mmm::send[mmm::comm = c.handle()][mmm::to = next()](std::span{values});
+
+  std::vector<double> in;
+  mmm::recv[mmm::comm = c.handle()][mmm::from = previous()][mmm::tag = 0](in);
+
+  TTS_EQUAL(in, std::vector<double>(5, 1.5 * previous()));
+};
+
+TTS_CASE("Check mmm::recv with options and default source and tag")
+{
+  mmm::send[mmm::to = next()][mmm::tag = 11](std::to_string(rank()));
+
+  auto s = mmm::recv[mmm::tag = 11](mmm::type<std::string>);
+  TTS_EQUAL(s, std::to_string(previous()));
+};
+
+TTS_CASE("Check mmm::send/recv with a mmm::communicator option")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  auto c = world.dup();
+
+  mmm::send[mmm::comm = c][mmm::to = next()][mmm::tag = 5](rank() + 100);
+
+  int i = -1;
+  auto st = mmm::recv[mmm::comm = c][mmm::from = previous()][mmm::tag = 5](i);
+
+  TTS_EQUAL(i, previous() + 100);
+  TTS_EQUAL(st.MPI_SOURCE, previous());
+
+  int value = rank();
+  auto r = mmm::isend[mmm::comm = world][mmm::to = next()][mmm::tag = 6](value);
+  auto j = mmm::recv[mmm::comm = world][mmm::from = previous()][mmm::tag = 6](mmm::type<int>);
+  r.wait();
+
+  TTS_EQUAL(j, previous());
+};
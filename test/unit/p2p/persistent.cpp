@@ -0,0 +1,128 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <concepts>
+#include <span>
+#include <vector>
+
+namespace
+{
+  int rank()
+  {
+    int r;
+    MPI_Comm_rank(MPI_COMM_WORLD, &r);
+    return r;
+  }
+
+  int size()
+  {
+    int s;
+    MPI_Comm_size(MPI_COMM_WORLD, &s);
+    return s;
+  }
+
+  int next()      { return (rank() + 1) % size(); }
+  int previous()  { return (rank() + size() - 1) % size(); }
+}
+
+TTS_CASE("Check mmm::send_init/recv_init reject temporaries")
+{
+  using send_t  = decltype(mmm::send_init);
+  using recv_t  = decltype(mmm::recv_init);
+  using to_t    = decltype(mmm::send_init[mmm::to = 0]);
+  using from_t  = decltype(mmm::recv_init[mmm::from = 0]);
+
+  TTS_EXPECT_NOT((std::invocable<send_t, int, int, int>));
+  TTS_EXPECT_NOT((std::invocable<send_t, std::vector<int>, int, int>));
+  TTS_EXPECT_NOT((std::invocable<recv_t, std::vector<int>, int, int>));
+  TTS_EXPECT_NOT((std::invocable<to_t, std::vector<int>>));
+  TTS_EXPECT_NOT((std::invocable<from_t, int>));
+
+  TTS_EXPECT((std::invocable<send_t, int const&, int, int>));
+  TTS_EXPECT((std::invocable<send_t, std::span<int const>, int, int>));
+  TTS_EXPECT((std::invocable<from_t, std::span<int>>));
+  TTS_EXPECT((std::invocable<to_t, std::vector<int>&>));
+};
+
+TTS_CASE("Check mmm::send_init/recv_init on values")
+{
+  int in = -1, out = 0;
+
+  auto r = mmm::recv_init(in, previous(), 5);
+  auto s = mmm::send_init(out, next(), 5);
+
+  TTS_EXPECT(static_cast<bool>(r));
+  TTS_EXPECT_NOT(r.active());
+
+  bool valid = true;
+  for(int step = 0; step < 10; ++step)
+  {
+    out = rank() * 100 + step;
+    r.start();
+    s.start();
+
+    auto st = r.wait();
+    s.wait();
+
+    valid = valid && in == previous() * 100 + step && st.MPI_SOURCE == previous();
+  }
+
+  TTS_EXPECT(valid);
+  TTS_EXPECT_NOT(r.active());
+};
+
+TTS_CASE("Check mmm::start_all with options on ranges")
+{
+  std::vector<double> out(32), in(32), back(32);
+  std::vector<double> echo(32);
+
+  auto s  = mmm::send_init[mmm::to = next()][mmm::tag = 6](out);
+  auto r  = mmm::recv_init[mmm::from = previous()][mmm::tag = 6](std::span{in});
+  auto sb = mmm::send_init[mmm::to = previous()][mmm::tag = 7](echo);
+  auto rb = mmm::recv_init[mmm::from = next()][mmm::tag = 7](back);
+
+  bool valid = true;
+  for(int step = 0; step < 5; ++step)
+  {
+    for(auto& v : out)  v = rank() + 0.5 * step;
+    for(auto& v : echo) v = -rank() - 1.;
+
+    mmm::start_all(kumi::tie(r, rb, s, sb));
+    auto status = mmm::wait_all(kumi::tie(r, rb, s, sb));
+
+    valid = valid && in   == std::vector<double>(32, previous() + 0.5 * step);
+    valid = valid && back == std::vector<double>(32, -next() - 1.);
+    valid = valid && status[0].MPI_TAG == 6 && status[1].MPI_TAG == 7;
+  }
+
+  TTS_EXPECT(valid);
+};
+
+TTS_CASE("Check mmm::persistent completion through test_some")
+{
+  int in = -1, out = rank();
+
+  auto r = mmm::recv_init(in, previous(), 8);
+  auto s = mmm::send_init(out, next(), 8);
+  mmm::start_all(r, s);
+
+  bool received = false, sent = false;
+  while(!received || !sent)
+  {
+    auto done = mmm::test_some(r, s);
+    received  = received || done[0].has_value();
+    sent      = sent     || done[1].has_value();
+  }
+
+  TTS_EQUAL(in, previous());
+
+  auto moved = std::move(r);
+  TTS_EXPECT_NOT(static_cast<bool>(r));
+  TTS_EXPECT(static_cast<bool>(moved));
+};
@@ -0,0 +1,126 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <concepts>
+#include <span>
+#include <vector>
+
+namespace
+{
+  int rank()
+  {
+    int r;
+    MPI_Comm_rank(MPI_COMM_WORLD, &r);
+    return r;
+  }
+
+  int size()
+  {
+    int s;
+    MPI_Comm_size(MPI_COMM_WORLD, &s);
+    return s;
+  }
+
+  int next()      { return (rank() + 1) % size(); }
+  int previous()  { return (rank() + size() - 1) % size(); }
+}
+
+TTS_CASE("Check mmm::isend/irecv on values")
+{
+  int in = -1, out = rank() * 10;
+
+  auto r = mmm::irecv(in, previous(), 1);
+  auto s = mmm::isend(out, next(), 1);
+
+  TTS_EXPECT(static_cast<bool>(r));
+  TTS_EQUAL(r.on_destroy(), mmm::request::wait_on_destroy);
+
+  auto st = r.wait();
+  while(!s.test()) {}
+
+  TTS_EQUAL(in, previous() * 10);
+  TTS_EQUAL(st.MPI_SOURCE, previous());
+  TTS_EXPECT_NOT(r.active());
+  TTS_EXPECT_NOT(s.active());
+};
+
+TTS_CASE("Check mmm::isend/irecv reject temporaries")
+{
+  using isend_t = decltype(mmm::isend);
+  using irecv_t = decltype(mmm::irecv);
+  using to_t    = decltype(mmm::isend[mmm::to = 0]);
+  using from_t  = decltype(mmm::irecv[mmm::from = 0]);
+
+  TTS_EXPECT_NOT((std::invocable<isend_t, int, int, int>));
+  TTS_EXPECT_NOT((std::invocable<isend_t, std::vector<int>, int, int>));
+  TTS_EXPECT_NOT((std::invocable<irecv_t, std::vector<int>, int, int>));
+  TTS_EXPECT_NOT((std::invocable<to_t, int>));
+  TTS_EXPECT_NOT((std::invocable<from_t, std::vector<int>>));
+
+  TTS_EXPECT((std::invocable<isend_t, int&, int, int>));
+  TTS_EXPECT((std::invocable<isend_t, std::span<int>, int, int>));
+  TTS_EXPECT((std::invocable<from_t, std::span<int>>));
+  TTS_EXPECT((std::invocable<from_t, std::vector<int>&>));
+};
+
+TTS_CASE("Check mmm::isend/irecv with options on ranges")
+{
+  std::vector<double> out(100, 0.5 * rank()), in(100);
+
+  {
+    auto r = mmm::irecv[mmm::from = previous()][mmm::tag = 2](std::span{in});
+    auto s = mmm::isend[mmm::to = next()][mmm::tag = 2](out);
+  }
+
+  TTS_EQUAL(in, std::vector<double>(100, 0.5 * previous()));
+};
+
+TTS_CASE("Check mmm::request cancellation on destruction")
+{
+  int never = 0;
+
+  {
+    auto r = mmm::irecv[mmm::from = rank()][mmm::tag = 99][mmm::cancel_on_destroy](never);
+    TTS_EQUAL(r.on_destroy(), mmm::request::cancel_on_destroy);
+    TTS_EXPECT(r.active());
+  }
+
+  TTS_EQUAL(never, 0);
+};
+
+TTS_CASE("Check mmm::request reuse of pooled handles")
+{
+  constexpr int n = 1000;
+  std::vector<int>          in(n, -1), out(n);
+  std::vector<mmm::request> pending;
+  pending.reserve(2*n);
+
+  for(int i = 0; i < n; ++i)
+  {
+    out[static_cast<std::size_t>(i)] = rank() * n + i;
+    pending.push_back(mmm::irecv(in[static_cast<std::size_t>(i)], previous(), i));
+    pending.push_back(mmm::isend(out[static_cast<std::size_t>(i)], next(), i));
+  }
+
+  pending.clear();
+
+  bool valid = true;
+  for(int i = 0; i < n; ++i) valid = valid && in[static_cast<std::size_t>(i)] == previous() * n + i;
+  TTS_EXPECT(valid);
+
+  mmm::request moved = mmm::isend(out[0], rank(), 0);
+  mmm::request other = std::move(moved);
+  TTS_EXPECT_NOT(moved.active());
+  TTS_EXPECT(other.active());
+
+  int self;
+  mmm::recv(self, rank(), 0);
+  other.wait();
+  TTS_EQUAL(self, out[0]);
+};
@@ -0,0 +1,29 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include <mmm/mmm.hpp>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+  // mmm::background is documented to request at least mmm::serialized thread support, as MPI
+  // is then used from another thread than the one which initialized it.
+  mmm::context mpi_context(argc, argv, mmm::thread_support::single, mmm::background);
+  mpi_context.wait();
+
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+
+  std::cout << "Process     : " << mpi_context.rank << "/" << mpi_context.size << "\n";
+  std::cout << "Thread level: " << mpi_context.thread_level << "\n";
+
+  bool valid  =   provided >= MPI_THREAD_SERIALIZED
+              &&  mpi_context.thread_level >= mmm::thread_support::serialized
+              &&  static_cast<int>(mpi_context.thread_level) == provided;
+
+  return valid ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <utility>
+
+TTS_CASE("Check mmm::communicator::synchronize_async")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+
+  auto r = world.synchronize_async();
+  TTS_EXPECT(r.active());
+
+  while(!r.test()) {}
+  TTS_EXPECT_NOT(r.active());
+
+  auto s = world.synchronize_async();
+  auto moved = std::move(s);
+  TTS_EXPECT_NOT(s.active());
+  TTS_EXPECT(moved.active());
+
+  moved.wait();
+  TTS_EXPECT_NOT(static_cast<bool>(moved));
+};
+
+TTS_CASE("Check mmm::request completes on destruction")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+
+  {
+    auto r = world.synchronize_async();
+  }
+
+  mmm::request none;
+  TTS_EXPECT_NOT(none.active());
+  TTS_EXPECT(none.test());
+};
+
+TTS_CASE("Check mmm::fuzzy_barrier")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  mmm::fuzzy_barrier barrier(world);
+
+  TTS_EXPECT_NOT(barrier.pending());
+  TTS_EXPECT(barrier.ready());
+
+  int steps = 0;
+  for(int i = 0; i < 4; ++i)
+  {
+    barrier.arrive();
+    TTS_EXPECT(barrier.pending());
+
+    // Local work overlapping the barrier
+    while(!barrier.ready()) {}
+    ++steps;
+
+    barrier.wait();
+    TTS_EXPECT_NOT(barrier.pending());
+  }
+
+  TTS_EQUAL(steps, 4);
+};
@@ -0,0 +1,113 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <vector>
+
+TTS_CASE("Check mmm::cartesian construction")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  mmm::cartesian<2> grid(world, {0,0}, {true,false});
+
+  TTS_EQUAL(grid.size(), world.size());
+  TTS_EQUAL(grid.dims()[0] * grid.dims()[1], world.size());
+  TTS_EXPECT(grid.periodic(0));
+  TTS_EXPECT_NOT(grid.periodic(1));
+  TTS_EQUAL(grid.neighbor({0,0}), grid.rank());
+
+  int c[2];
+  MPI_Cart_coords(grid.comm().handle(), grid.rank(), 2, c);
+  TTS_EQUAL(grid.coords()[0], c[0]);
+  TTS_EQUAL(grid.coords()[1], c[1]);
+
+  int up, down;
+  MPI_Cart_shift(grid.comm().handle(), 0, 1, &up, &down);
+  TTS_EQUAL(grid.neighbor({-1,0}), up);
+  TTS_EQUAL(grid.neighbor({ 1,0}), down);
+
+  MPI_Cart_shift(grid.comm().handle(), 1, 1, &up, &down);
+  TTS_EQUAL(grid.neighbor({0,-1}), up);
+  TTS_EQUAL(grid.neighbor({0, 1}), down);
+};
+
+TTS_CASE("Check mmm::halo_exchange over a periodic 2D grid")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  mmm::cartesian<2> grid(world, {0,0}, {true,true});
+
+  constexpr std::ptrdiff_t nx = 4, ny = 5, w = 1;
+  std::vector<int> block((nx+2*w)*(ny+2*w), -1);
+  mmm::view local(block.data(), {nx+2*w, ny+2*w});
+
+  for(std::ptrdiff_t i = w; i < nx+w; ++i)
+    for(std::ptrdiff_t j = w; j < ny+w; ++j)
+      block[i*(ny+2*w)+j] = grid.rank();
+
+  TTS_EQUAL(mmm::halo_exchange(grid, local, w), MPI_SUCCESS);
+
+  auto side = [](std::ptrdiff_t i, std::ptrdiff_t n) { return i < w ? -1 : (i >= n+w ? 1 : 0); };
+
+  bool valid = true;
+  for(std::ptrdiff_t i = 0; i < nx+2*w; ++i)
+    for(std::ptrdiff_t j = 0; j < ny+2*w; ++j)
+      valid = valid && block[i*(ny+2*w)+j] == grid.neighbor({side(i,nx), side(j,ny)});
+
+  TTS_EXPECT(valid);
+};
+
+TTS_CASE("Check mmm::halo_exchange over a non-periodic 3D grid")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  mmm::cartesian<3> grid(world);
+
+  constexpr std::ptrdiff_t n = 6, w = 2, e = n+2*w;
+  std::vector<double> block(e*e*e, -1.);
+  mmm::view local(block.data(), {e,e,e});
+
+  for(std::ptrdiff_t i = w; i < n+w; ++i)
+    for(std::ptrdiff_t j = w; j < n+w; ++j)
+      for(std::ptrdiff_t k = w; k < n+w; ++k)
+        block[(i*e+j)*e+k] = grid.rank() + 0.5;
+
+  TTS_EQUAL(mmm::halo_exchange(grid, local, w), MPI_SUCCESS);
+
+  auto side = [](std::ptrdiff_t i) { return i < w ? -1 : (i >= n+w ? 1 : 0); };
+
+  bool valid = true;
+  for(std::ptrdiff_t i = 0; i < e; ++i)
+    for(std::ptrdiff_t j = 0; j < e; ++j)
+      for(std::ptrdiff_t k = 0; k < e; ++k)
+      {
+        auto from     = grid.neighbor({side(i), side(j), side(k)});
+        auto expected = from == MPI_PROC_NULL ? -1. : from + 0.5;
+        valid = valid && block[(i*e+j)*e+k] == expected;
+      }
+
+  TTS_EXPECT(valid);
+};
+
+TTS_CASE("Check mmm::halo_exchange argument checks and excluded processes")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+
+  std::vector<int> block(6*6, -1);
+  mmm::view local(block.data(), {6,6});
+
+  mmm::cartesian<2> grid(world, {0,0}, {true,true});
+  TTS_EQUAL(mmm::halo_exchange(grid, local, -1), MPI_ERR_ARG);
+  TTS_EQUAL(mmm::halo_exchange(grid, local,  4), MPI_ERR_ARG);
+
+  // Sent regions would overlap the opposite ghost regions
+  TTS_EQUAL(mmm::halo_exchange(grid, local,  3), MPI_ERR_ARG);
+  TTS_EQUAL(mmm::halo_exchange(grid, local,  2), MPI_SUCCESS);
+
+  // Only the first process fits in this grid
+  mmm::cartesian<2> single(world, {1,1}, {true,true});
+  TTS_EQUAL(static_cast<bool>(single.comm()), world.rank() == 0);
+  TTS_EQUAL(mmm::halo_exchange(single, local, 1), MPI_SUCCESS);
+};
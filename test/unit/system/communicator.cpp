@@ -0,0 +1,68 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <utility>
+
+TTS_CASE("Check mmm::communicator over a predefined communicator")
+{
+  int size, rank;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  mmm::communicator world(MPI_COMM_WORLD);
+
+  TTS_EXPECT(static_cast<bool>(world));
+  TTS_EQUAL(world.size()  , size);
+  TTS_EQUAL(world.rank()  , rank);
+  TTS_EQUAL(world.handle(), MPI_COMM_WORLD);
+
+  mmm::communicator none;
+  TTS_EXPECT_NOT(static_cast<bool>(none));
+  TTS_EQUAL(none.size(), 0);
+  TTS_EQUAL(none.rank(), MPI_UNDEFINED);
+};
+
+TTS_CASE("Check mmm::communicator::dup")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  auto copy = world.dup();
+
+  int result;
+  MPI_Comm_compare(world.handle(), copy.handle(), &result);
+
+  TTS_EQUAL(result      , MPI_CONGRUENT);
+  TTS_EQUAL(copy.size() , world.size());
+  TTS_EQUAL(copy.rank() , world.rank());
+
+  auto moved = std::move(copy);
+  TTS_EXPECT_NOT(static_cast<bool>(copy));
+  TTS_EQUAL(moved.rank(), world.rank());
+};
+
+TTS_CASE("Check mmm::communicator::split")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  auto parity = world.split(world.rank() % 2, world.rank());
+
+  TTS_EQUAL(parity.size(), (world.size() + 1 - world.rank() % 2) / 2);
+  TTS_EQUAL(parity.rank(), world.rank() / 2);
+
+  auto first = world.split(world.rank() == 0 ? 0 : MPI_UNDEFINED);
+  TTS_EQUAL(static_cast<bool>(first), world.rank() == 0);
+};
+
+TTS_CASE("Check mmm::communicator::split_type")
+{
+  mmm::communicator world(MPI_COMM_WORLD);
+  auto node = world.split_type(mmm::shared, world.rank());
+
+  TTS_EXPECT(node.size() >= 1);
+  TTS_EXPECT(node.size() <= world.size());
+  TTS_EXPECT(node.rank() <= world.rank());
+};
@@ -15,4 +15,13 @@ int main(int argc, char** argv)
   std::cout << "Process     : " << mpi_context.rank << "/" << mpi_context.size << "\n";
   std::cout << "Host        : " << mpi_context.node_id << "\n";
   std::cout << "Thread level: " << mpi_context.thread_level << "\n";
+  std::cout << "Node        : " << mpi_context.node_index << "/" << mpi_context.node_count
+            << " - local rank " << mpi_context.node_rank  << "/" << mpi_context.node_size << "\n";
+
+  bool valid  =   mpi_context.node_rank  < mpi_context.node_size
+              &&  mpi_context.node_index < mpi_context.node_count
+              &&  mpi_context.node().size() == mpi_context.node_size
+              &&  static_cast<bool>(mpi_context.leaders()) == (mpi_context.node_rank == 0);
+
+  return valid ? 0 : 1;
 }
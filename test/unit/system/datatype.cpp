@@ -41,3 +41,186 @@ TTS_CASE("Check datatype for specific pair types")
   TTS_EQUAL(mmm::datatype(mmm::type<std::pair<int, int>>)         , MPI_2INT            );
   TTS_EQUAL(mmm::datatype(mmm::type<std::pair<long, int>>)        , MPI_LONG_INT        );
 };
+
+namespace
+{
+  struct particle
+  {
+    char          kind;
+    double        x, y;
+    std::int32_t  id;
+  };
+
+  struct cell
+  {
+    particle      p;
+    std::int16_t  flags;
+  };
+
+  // Largest aggregate supported by reflection
+  struct wide
+  {
+    int a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15;
+    int b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15;
+  };
+
+  MPI_Aint extent_of(MPI_Datatype t)
+  {
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(t, &lb, &extent);
+    return extent;
+  }
+
+  template<typename T> T round_trip(T const& in)
+  {
+    T out{};
+    auto t = mmm::datatype(mmm::type<T>);
+    MPI_Sendrecv( &in , 1, t, 0, 0
+                , &out, 1, t, 0, 0
+                , MPI_COMM_SELF, MPI_STATUS_IGNORE
+                );
+    return out;
+  }
+}
+
+TTS_CASE("Check datatype for aggregate types")
+{
+  auto t = mmm::datatype(mmm::type<particle>);
+  TTS_EQUAL(t, mmm::datatype(mmm::type<particle>));
+  TTS_EQUAL(extent_of(t), static_cast<MPI_Aint>(sizeof(particle)));
+
+  auto p = round_trip(particle{'e', 1.5, -2.25, 42});
+  TTS_EQUAL(p.kind, 'e'   );
+  TTS_EQUAL(p.x   , 1.5   );
+  TTS_EQUAL(p.y   , -2.25 );
+  TTS_EQUAL(p.id  , 42    );
+
+  auto c = round_trip(cell{ {'p', 0.5, 4.0, 7}, 13 });
+  TTS_EQUAL(c.p.kind, 'p' );
+  TTS_EQUAL(c.p.x   , 0.5 );
+  TTS_EQUAL(c.p.y   , 4.0 );
+  TTS_EQUAL(c.p.id  , 7   );
+  TTS_EQUAL(c.flags , std::int16_t{13});
+
+  TTS_EQUAL(mmm::detail::field_count<wide>, mmm::detail::max_fields);
+
+  wide w{};
+  w.a0 = 1; w.b15 = 32;
+  auto r = round_trip(w);
+  TTS_EQUAL(r.a0  , 1 );
+  TTS_EQUAL(r.b15 , 32);
+};
+
+TTS_CASE("Check datatype for tuple types")
+{
+  using std_t  = std::tuple<char, double, std::int16_t>;
+  using kumi_t = kumi::tuple<float, std::int64_t, std::uint8_t>;
+
+  TTS_EQUAL(mmm::datatype(mmm::type<std_t>) , mmm::datatype(mmm::type<std_t>) );
+  TTS_EQUAL(mmm::datatype(mmm::type<kumi_t>), mmm::datatype(mmm::type<kumi_t>));
+
+  TTS_EQUAL(extent_of(mmm::datatype(mmm::type<std_t>)) , static_cast<MPI_Aint>(sizeof(std_t)) );
+  TTS_EQUAL(extent_of(mmm::datatype(mmm::type<kumi_t>)), static_cast<MPI_Aint>(sizeof(kumi_t)));
+
+  TTS_EQUAL(round_trip(std_t{'z', 3.25, 17}), (std_t{'z', 3.25, 17}));
+  TTS_EQUAL(round_trip(kumi_t{1.5f, -99, 200}), (kumi_t{1.5f, -99, 200}));
+};
+
+namespace
+{
+  struct record
+  {
+    double        value;
+    std::int64_t  key;
+    float         weight;
+    std::int32_t  rank;
+  };
+
+  struct wrapped
+  {
+    record  r;
+    double  scale;
+  };
+
+  int combiner_of(MPI_Datatype t)
+  {
+    int ni, na, nd, combiner;
+    MPI_Type_get_envelope(t, &ni, &na, &nd, &combiner);
+    return combiner;
+  }
+}
+
+TTS_CASE("Check datatype for padding-free types")
+{
+  TTS_EQUAL(combiner_of(mmm::datatype(mmm::type<record>)) , MPI_COMBINER_CONTIGUOUS);
+  TTS_EQUAL(combiner_of(mmm::datatype(mmm::type<wrapped>)), MPI_COMBINER_CONTIGUOUS);
+  TTS_EQUAL(combiner_of(mmm::datatype(mmm::type<particle>)), MPI_COMBINER_RESIZED  );
+
+  using kumi_t = kumi::tuple<double, std::int32_t, std::int32_t>;
+  TTS_EQUAL(combiner_of(mmm::datatype(mmm::type<kumi_t>)), MPI_COMBINER_CONTIGUOUS);
+
+  TTS_EQUAL(extent_of(mmm::datatype(mmm::type<record>)), static_cast<MPI_Aint>(sizeof(record)));
+
+  auto w = round_trip(wrapped{ {2.5, -7, 0.25f, 3}, 8.0 });
+  TTS_EQUAL(w.r.value , 2.5   );
+  TTS_EQUAL(w.r.key   , -7    );
+  TTS_EQUAL(w.r.weight, 0.25f );
+  TTS_EQUAL(w.r.rank  , 3     );
+  TTS_EQUAL(w.scale   , 8.0   );
+};
+
+namespace
+{
+  enum class color : std::int16_t { red, green, blue };
+  enum legacy : std::uint32_t { first, second };
+
+  struct sample
+  {
+    double                position[3];
+    std::array<float, 2>  uv;
+    color                 tint;
+  };
+}
+
+TTS_CASE("Check datatype for complex, std::byte and enumeration types")
+{
+  TTS_EQUAL(mmm::datatype(mmm::type<std::complex<float>>)      , MPI_C_FLOAT_COMPLEX       );
+  TTS_EQUAL(mmm::datatype(mmm::type<std::complex<double>>)     , MPI_C_DOUBLE_COMPLEX      );
+  TTS_EQUAL(mmm::datatype(mmm::type<std::complex<long double>>), MPI_C_LONG_DOUBLE_COMPLEX );
+
+  TTS_EQUAL(mmm::datatype(mmm::type<std::byte>), MPI_BYTE    );
+  TTS_EQUAL(mmm::datatype(mmm::type<color>)    , MPI_INT16_T );
+  TTS_EQUAL(mmm::datatype(mmm::type<legacy>)   , MPI_UINT32_T);
+};
+
+TTS_CASE("Check datatype for std::array and C array types")
+{
+  auto a = mmm::datatype(mmm::type<std::array<double,4>>);
+  auto c = mmm::datatype(mmm::type<std::int32_t[3]>);
+
+  TTS_EQUAL(combiner_of(a), MPI_COMBINER_CONTIGUOUS);
+  TTS_EQUAL(combiner_of(c), MPI_COMBINER_CONTIGUOUS);
+  TTS_EQUAL(extent_of(a), static_cast<MPI_Aint>(4*sizeof(double)));
+  TTS_EQUAL(extent_of(c), static_cast<MPI_Aint>(3*sizeof(std::int32_t)));
+
+  // The underlying element type is kept so reductions are still typed
+  int ni, na, nd, combiner;
+  MPI_Type_get_envelope(a, &ni, &na, &nd, &combiner);
+  TTS_EQUAL(nd, 1);
+
+  int          count;
+  MPI_Datatype inner;
+  MPI_Type_get_contents(a, ni, na, nd, &count, nullptr, &inner);
+  TTS_EQUAL(count, 4        );
+  TTS_EQUAL(inner, MPI_DOUBLE);
+
+  TTS_EQUAL(round_trip(std::array<double,4>{1,2,3,4}), (std::array<double,4>{1,2,3,4}));
+
+  auto s = round_trip(sample{ {1.5, 2.5, 3.5}, {0.25f, 0.75f}, color::blue });
+  TTS_EQUAL(s.position[0], 1.5    );
+  TTS_EQUAL(s.position[1], 2.5    );
+  TTS_EQUAL(s.position[2], 3.5    );
+  TTS_EQUAL(s.uv[0]      , 0.25f  );
+  TTS_EQUAL(s.uv[1]      , 0.75f  );
+  TTS_EQUAL(static_cast<int>(s.tint), static_cast<int>(color::blue));
+};
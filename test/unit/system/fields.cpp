@@ -0,0 +1,71 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <vector>
+
+namespace
+{
+  struct particle
+  {
+    double  x[3], v[3], f[3];
+    int     id;
+    char    tag;
+  };
+
+  MPI_Aint extent_of(MPI_Datatype t)
+  {
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(t, &lb, &extent);
+    return extent;
+  }
+
+  int size_of(MPI_Datatype t)
+  {
+    int s;
+    MPI_Type_size(t, &s);
+    return s;
+  }
+}
+
+TTS_CASE("Check mmm::fields projection datatype")
+{
+  auto t = mmm::datatype(mmm::type<particle>, mmm::fields<&particle::x, &particle::id>);
+
+  TTS_EQUAL(extent_of(t), static_cast<MPI_Aint>(sizeof(particle)));
+  TTS_EQUAL(size_of(t)  , static_cast<int>(3*sizeof(double) + sizeof(int)));
+  TTS_EQUAL(t, (mmm::datatype(mmm::type<particle>, mmm::fields<&particle::x, &particle::id>)));
+  TTS_NOT_EQUAL(t, (mmm::datatype(mmm::type<particle>, mmm::fields<&particle::id, &particle::x>)));
+};
+
+TTS_CASE("Check mmm::fields only moves the selected members")
+{
+  std::vector<particle> in(5), out(5);
+  for(std::size_t i = 0; i < in.size(); ++i)
+  {
+    auto d = static_cast<double>(i);
+    in[i]  = particle{ {d,d+1,d+2}, {-d,-d,-d}, {9,9,9}, static_cast<int>(i), 'x' };
+    out[i] = particle{ {0,0,0}, {0,0,0}, {0,0,0}, -1, 'o' };
+  }
+
+  auto t = mmm::datatype(mmm::type<particle>, mmm::fields<&particle::v, &particle::x>);
+  MPI_Sendrecv( in.data() , 5, t, 0, 0
+              , out.data(), 5, t, 0, 0
+              , MPI_COMM_SELF, MPI_STATUS_IGNORE
+              );
+
+  for(std::size_t i = 0; i < in.size(); ++i)
+  {
+    auto d = static_cast<double>(i);
+    TTS_EQUAL(out[i].x[2], d+2);
+    TTS_EQUAL(out[i].v[0], -d );
+    TTS_EQUAL(out[i].f[1], 0. );
+    TTS_EQUAL(out[i].id  , -1 );
+    TTS_EQUAL(out[i].tag , 'o');
+  }
+};
@@ -0,0 +1,142 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <climits>
+#include <vector>
+
+namespace
+{
+  mmm::communicator const& world()
+  {
+    static mmm::communicator w(MPI_COMM_WORLD);
+    return w;
+  }
+
+  int next()      { return (world().rank() + 1) % world().size(); }
+  int previous()  { return (world().rank() + world().size() - 1) % world().size(); }
+
+  // Directed ring: receive from previous, send to next
+  mmm::graph ring()
+  {
+    int sources[] = { previous() }, destinations[] = { next() };
+    return mmm::graph(world(), sources, destinations);
+  }
+}
+
+TTS_CASE("Check mmm::graph construction")
+{
+  std::vector<int> neighbors = { previous(), next() };
+  mmm::graph g(world(), neighbors);
+
+  TTS_EQUAL(g.size()      , world().size());
+  TTS_EQUAL(g.rank()      , world().rank());
+  TTS_EQUAL(g.in_degree() , 2ULL);
+  TTS_EQUAL(g.out_degree(), 2ULL);
+  TTS_EQUAL(g.sources()     , neighbors);
+  TTS_EQUAL(g.destinations(), neighbors);
+
+  int status;
+  MPI_Topo_test(g.comm().handle(), &status);
+  TTS_EQUAL(status, MPI_DIST_GRAPH);
+};
+
+TTS_CASE("Check mmm::graph::neighbor_allgather")
+{
+  std::vector<int> neighbors = { previous(), next() };
+  mmm::graph g(world(), neighbors);
+
+  std::vector<double> in = { 1. * g.rank(), 0.5 * g.rank() }, out(4), async(4);
+  TTS_EQUAL(g.neighbor_allgather(in, out), MPI_SUCCESS);
+
+  auto r = g.ineighbor_allgather(in, async);
+  r.wait();
+
+  std::vector<double> expected = { 1. * previous(), 0.5 * previous(), 1. * next(), 0.5 * next() };
+  TTS_EQUAL(out  , expected);
+  TTS_EQUAL(async, expected);
+};
+
+TTS_CASE("Check mmm::graph::neighbor_alltoall")
+{
+  auto g = ring();
+
+  std::vector<int> in = { g.rank(), 3 * g.rank() }, out(2), async(2);
+  TTS_EQUAL(g.neighbor_alltoall(in, out), MPI_SUCCESS);
+
+  auto r = g.ineighbor_alltoall(in, async);
+  r.wait();
+
+  std::vector<int> expected = { previous(), 3 * previous() };
+  TTS_EQUAL(out  , expected);
+  TTS_EQUAL(async, expected);
+};
+
+TTS_CASE("Check mmm::graph::neighbor_alltoallv")
+{
+  auto g = ring();
+
+  std::vector<float> in(static_cast<std::size_t>(g.rank() + 1), static_cast<float>(g.rank()));
+  std::vector<float> out(static_cast<std::size_t>(previous() + 1)), async(out.size());
+
+  std::size_t sends[] = { std::size_t(g.rank() + 1) }, recvs[] = { std::size_t(previous() + 1) };
+  TTS_EQUAL(g.neighbor_alltoallv(in, sends, out, recvs), MPI_SUCCESS);
+
+  auto r = g.ineighbor_alltoallv(in, sends, async, recvs);
+  TTS_EXPECT(r.active());
+  r.wait();
+
+  std::vector<float> expected(out.size(), static_cast<float>(previous()));
+  TTS_EQUAL(out  , expected);
+  TTS_EQUAL(async, expected);
+};
+
+TTS_CASE("Check mmm::graph::neighbor_alltoallw")
+{
+  auto g = ring();
+
+  // Send the second column of a 4x4 matrix, receive it as the first row of another
+  std::vector<int> m(16), out(16, -1), async(16, -1);
+  for(int i = 0; i < 16; ++i) m[static_cast<std::size_t>(i)] = 100 * g.rank() + i;
+
+  std::vector<mmm::view<int,1>> column  = { mmm::view(m.data() + 1, {4}, {4}) };
+  std::vector<mmm::view<int,1>> row     = { mmm::view(out.data()  , {4}) };
+  std::vector<mmm::view<int,1>> arow    = { mmm::view(async.data(), {4}) };
+
+  TTS_EQUAL(g.neighbor_alltoallw(column, row), MPI_SUCCESS);
+  {
+    auto r = g.ineighbor_alltoallw(column, arow);
+  }
+
+  std::vector<int> expected(16, -1);
+  for(int i = 0; i < 4; ++i) expected[static_cast<std::size_t>(i)] = 100 * previous() + 1 + 4*i;
+
+  TTS_EQUAL(out  , expected);
+  TTS_EQUAL(async, expected);
+};
+
+#if !defined(MMM_HAS_LARGE_COUNT)
+TTS_CASE("Check mmm::graph::neighbor_alltoallv rejects counts larger than an int")
+{
+  auto g = ring();
+  constexpr std::size_t max = INT_MAX;
+
+  // Nothing is transferred as the last displacement can't be represented
+  std::vector<float> in(1), out(1);
+  std::size_t sends[] = { max, max, 1 }, recvs[] = { 1 };
+  TTS_EQUAL(g.neighbor_alltoallv(in, sends, out, recvs), MPI_ERR_COUNT);
+
+  auto r = g.ineighbor_alltoallv(in, sends, out, recvs);
+  TTS_EXPECT_NOT(r.active());
+
+  // Nor when a count itself can't be represented
+  std::size_t large[] = { max + 1 };
+  TTS_EQUAL(g.neighbor_alltoallv(in, large, out, recvs), MPI_ERR_COUNT);
+  TTS_EQUAL(g.neighbor_alltoallv(in, recvs, out, large), MPI_ERR_COUNT);
+};
+#endif
@@ -0,0 +1,106 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <complex>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  template<typename T>
+  std::vector<float> reduce(MPI_Op op, std::vector<float> const& a, std::vector<float> const& b)
+  {
+    std::vector<T> in, inout;
+    for(auto v : a) in.push_back(static_cast<T>(v));
+    for(auto v : b) inout.push_back(static_cast<T>(v));
+
+    MPI_Reduce_local( in.data(), inout.data(), static_cast<int>(in.size())
+                    , mmm::datatype(mmm::type<T>), mmm::reduction(op, mmm::type<T>)
+                    );
+
+    std::vector<float> out;
+    for(auto v : inout) out.push_back(static_cast<float>(v));
+    return out;
+  }
+}
+
+TTS_CASE("Check mmm::bfloat16 conversions")
+{
+  TTS_EQUAL(static_cast<float>(mmm::bfloat16(1.5f))   , 1.5f    );
+  TTS_EQUAL(static_cast<float>(mmm::bfloat16(-256.f)) , -256.f  );
+  TTS_EQUAL(mmm::bfloat16(1.0f).bits                  , 0x3F80u );
+
+  // Ties go to the even mantissa: 1 + 2^-8 rounds down to 1, 1 + 3.2^-8 rounds up to 1 + 2^-6
+  TTS_EQUAL(static_cast<float>(mmm::bfloat16(1.00390625f)), 1.0f);
+  TTS_EQUAL(static_cast<float>(mmm::bfloat16(1.01171875f)), 1.015625f);
+
+  // Other values go to the nearest: 1 + 2^-8 + 2^-16 rounds up to 1 + 2^-7
+  TTS_EQUAL(static_cast<float>(mmm::bfloat16(1.0039215087890625f)), 1.0078125f);
+
+  auto nan = static_cast<float>(mmm::bfloat16(std::numeric_limits<float>::quiet_NaN()));
+  TTS_EXPECT(nan != nan);
+};
+
+TTS_CASE("Check reductions over predefined datatypes")
+{
+  using pair_t = std::pair<double,int>;
+
+  TTS_EQUAL(mmm::reduction(MPI_MAX    , mmm::type<double>)              , MPI_MAX     );
+  TTS_EQUAL(mmm::reduction(MPI_BAND   , mmm::type<double>)              , MPI_OP_NULL );
+  TTS_EQUAL(mmm::reduction(MPI_SUM    , mmm::type<std::complex<float>>) , MPI_SUM     );
+  TTS_EQUAL(mmm::reduction(MPI_MAX    , mmm::type<std::complex<float>>) , MPI_OP_NULL );
+  TTS_EQUAL(mmm::reduction(MPI_BXOR   , mmm::type<std::byte>)           , MPI_BXOR    );
+  TTS_EQUAL(mmm::reduction(MPI_SUM    , mmm::type<std::byte>)           , MPI_OP_NULL );
+  TTS_EQUAL(mmm::reduction(MPI_LOR    , mmm::type<bool>)                , MPI_LOR     );
+  TTS_EQUAL(mmm::reduction(MPI_BAND   , mmm::type<unsigned>)            , MPI_BAND    );
+  TTS_EQUAL(mmm::reduction(MPI_MAXLOC , mmm::type<pair_t>)              , MPI_MAXLOC  );
+  TTS_EQUAL(mmm::reduction(MPI_SUM    , mmm::type<pair_t>)              , MPI_OP_NULL );
+  TTS_EQUAL(mmm::reduction(MPI_REPLACE, mmm::type<std::complex<float>>) , MPI_REPLACE );
+};
+
+TTS_CASE("Check datatype and reductions for 16 bits floating-point types")
+{
+  TTS_EQUAL(mmm::reduction(MPI_SUM, mmm::type<float>), MPI_SUM);
+  TTS_EQUAL(mmm::reduction(MPI_MAX, mmm::type<int>)  , MPI_MAX);
+
+  auto t = mmm::datatype(mmm::type<mmm::bfloat16>);
+  MPI_Aint lb, extent;
+  MPI_Type_get_extent(t, &lb, &extent);
+  TTS_EQUAL(extent, MPI_Aint{2});
+
+  std::vector<float> a = {1.f, -2.f, 3.5f, 8.f, 0.25f}, b = {2.f, 4.f, -1.f, 8.f, 0.5f};
+
+  TTS_EQUAL(reduce<mmm::bfloat16>(MPI_SUM, a, b), (std::vector<float>{3.f, 2.f, 2.5f, 16.f, 0.75f}));
+  TTS_EQUAL(reduce<mmm::bfloat16>(MPI_MAX, a, b), (std::vector<float>{2.f, 4.f, 3.5f, 8.f, 0.5f}));
+  TTS_EQUAL(reduce<mmm::bfloat16>(MPI_MIN, a, b), (std::vector<float>{1.f, -2.f, -1.f, 8.f, 0.25f}));
+  TTS_EQUAL(mmm::reduction(MPI_PROD, mmm::type<mmm::bfloat16>), MPI_OP_NULL);
+
+#if defined(MMM_HAS_FLOAT16)
+  TTS_EQUAL(reduce<mmm::float16>(MPI_SUM, a, b), (std::vector<float>{3.f, 2.f, 2.5f, 16.f, 0.75f}));
+  TTS_EQUAL(reduce<mmm::float16>(MPI_MAX, a, b), (std::vector<float>{2.f, 4.f, 3.5f, 8.f, 0.5f}));
+  TTS_EQUAL(reduce<mmm::float16>(MPI_MIN, a, b), (std::vector<float>{1.f, -2.f, -1.f, 8.f, 0.25f}));
+#endif
+};
+
+TTS_CASE("Check all-reduce over mmm::bfloat16")
+{
+  int size;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  std::vector<mmm::bfloat16> data(64, mmm::bfloat16(1.f)), out(64);
+  MPI_Allreduce ( data.data(), out.data(), 64
+                , mmm::datatype(mmm::type<mmm::bfloat16>)
+                , mmm::reduction(MPI_SUM, mmm::type<mmm::bfloat16>)
+                , MPI_COMM_WORLD
+                );
+
+  TTS_EQUAL(static_cast<float>(out[0]) , static_cast<float>(size));
+  TTS_EQUAL(static_cast<float>(out[63]), static_cast<float>(size));
+};
@@ -0,0 +1,96 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+  // Send a selection to ourselves and receive it as a contiguous sequence of elements
+  template<typename T, typename I> std::vector<T> gather(mmm::indexed<T,I> const& x)
+  {
+    std::vector<T> out(static_cast<std::size_t>(x.size()));
+    MPI_Sendrecv( x.data()  , 1                         , mmm::datatype(x)            , 0, 0
+                , out.data(), static_cast<int>(x.size()), mmm::datatype(mmm::type<T>) , 0, 0
+                , MPI_COMM_SELF, MPI_STATUS_IGNORE
+                );
+    return out;
+  }
+
+  int combiner_of(MPI_Datatype t)
+  {
+    int ni, na, nd, combiner;
+    MPI_Type_get_envelope(t, &ni, &na, &nd, &combiner);
+    return combiner;
+  }
+}
+
+TTS_CASE("Check mmm::indexed with blocks of identical length")
+{
+  std::vector<double> field(32);
+  for(std::size_t i = 0; i < field.size(); ++i) field[i] = static_cast<double>(i);
+
+  std::vector<int> ghosts = {3, 17, 9, 28};
+  mmm::indexed single(field.data(), ghosts);
+  mmm::indexed pairs(field.data(), ghosts, 2);
+
+  TTS_EQUAL(single.size(), 4);
+  TTS_EQUAL(pairs.size() , 8);
+
+  TTS_EQUAL(combiner_of(mmm::datatype(single)), MPI_COMBINER_HINDEXED_BLOCK);
+  TTS_EQUAL(gather(single), (std::vector<double>{3,17,9,28}));
+  TTS_EQUAL(gather(pairs) , (std::vector<double>{3,4,17,18,9,10,28,29}));
+};
+
+TTS_CASE("Check mmm::indexed with blocks of varying length")
+{
+  std::vector<std::int64_t> field(16);
+  for(std::size_t i = 0; i < field.size(); ++i) field[i] = static_cast<std::int64_t>(i);
+
+  std::vector<long> starts  = {1, 7, 12};
+  std::vector<long> lengths = {3, 1, 2};
+  mmm::indexed sel(field.data(), starts, lengths);
+
+  TTS_EQUAL(sel.size(), 6);
+  TTS_EQUAL(combiner_of(mmm::datatype(sel)), MPI_COMBINER_HINDEXED);
+  TTS_EQUAL(gather(sel), (std::vector<std::int64_t>{1,2,3,7,12,13}));
+};
+
+TTS_CASE("Check mmm::indexed datatype caching")
+{
+  std::vector<float> a(16), b(16);
+  std::vector<int>   p0 = {1, 5, 9}, p1 = {1, 5, 9}, p2 = {1, 5, 10};
+
+  mmm::indexed x0(a.data(), p0), x1(b.data(), p1), x2(a.data(), p2);
+
+  TTS_EQUAL    (x0.hash(), x1.hash());
+  TTS_EQUAL    (mmm::datatype(x0), mmm::datatype(x1));
+  TTS_NOT_EQUAL(mmm::datatype(x0), mmm::datatype(x2));
+};
+
+TTS_CASE("Check mmm::indexed with wide indexes")
+{
+  // Indexes past INT_MAX are kept as byte displacements
+  std::vector<std::size_t> far = {0, std::size_t{1} << 32};
+  mmm::indexed sel(static_cast<char*>(nullptr), far);
+
+  MPI_Aint lb, extent;
+  MPI_Type_get_extent(mmm::datatype(sel), &lb, &extent);
+  TTS_EQUAL(lb    , MPI_Aint{0});
+  TTS_EQUAL(extent, (MPI_Aint{1} << 32) + 1);
+
+  // Blocks longer than an int can count have no datatype
+  std::vector<std::int64_t> starts = {0}, lengths = {std::int64_t{INT_MAX} + 1};
+  mmm::indexed identical(static_cast<char*>(nullptr), starts, std::int64_t{INT_MAX} + 1);
+  mmm::indexed varying(static_cast<char*>(nullptr), starts, lengths);
+
+  TTS_EQUAL(mmm::datatype(identical), MPI_DATATYPE_NULL);
+  TTS_EQUAL(mmm::datatype(varying)  , MPI_DATATYPE_NULL);
+};
@@ -0,0 +1,46 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include <mmm/mmm.hpp>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+  mmm::context mpi_context(argc, argv, mmm::thread_support::serialized, mmm::background, mmm::lazy);
+
+  // Application setup overlapping MPI initialization
+  std::vector<int> data(1024);
+  std::iota(data.begin(), data.end(), 0);
+
+  mpi_context.wait();
+
+  int total = 0, local = 1;
+  MPI_Allreduce(&local, &total, 1, MPI_INT, MPI_SUM, mpi_context.world().handle());
+
+  std::cout << "Process     : " << mpi_context.rank << "/" << mpi_context.size << "\n";
+  std::cout << "Thread level: " << mpi_context.thread_level << "\n";
+
+  // Lazy queries leave the members untouched until they are performed
+  bool pending = mpi_context.node_id.empty() && mpi_context.node_size == 0;
+
+  std::cout << "Node        : " << mpi_context.query_node_index() << "/"
+            << mpi_context.query_node_count() << " - local rank "
+            << mpi_context.query_node_rank()  << "/" << mpi_context.query_node_size() << "\n";
+  std::cout << "Host        : " << mpi_context.query_node_id() << "\n";
+
+  bool valid  =   pending
+              &&  total == mpi_context.size
+              &&  mpi_context.thread_level >= mmm::thread_support::serialized
+              &&  mpi_context.node_rank  < mpi_context.node_size
+              &&  mpi_context.node().size() == mpi_context.node_size
+              &&  !mpi_context.node_id.empty()
+              &&  data.back() == 1023;
+
+  return valid ? 0 : 1;
+}
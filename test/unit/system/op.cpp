@@ -0,0 +1,87 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <vector>
+
+namespace
+{
+  struct stats
+  {
+    double        sum;
+    std::int32_t  count;
+  };
+
+  int is_commutative(MPI_Op o)
+  {
+    int c;
+    MPI_Op_commutative(o, &c);
+    return c;
+  }
+}
+
+TTS_CASE("Check mmm::op creation and caching")
+{
+  auto sq  = [](double a, double b) { return a*a + b; };
+  auto o   = mmm::op(sq, mmm::type<double>);
+  auto oc  = mmm::op[mmm::commutative](sq, mmm::type<double>);
+
+  TTS_NOT_EQUAL(o, MPI_OP_NULL);
+  TTS_EQUAL(o , mmm::op(sq, mmm::type<double>));
+  TTS_EQUAL(oc, mmm::op[mmm::commutative](sq, mmm::type<double>));
+  TTS_NOT_EQUAL(o, oc);
+  TTS_NOT_EQUAL(o, mmm::op(sq, mmm::type<float>));
+
+  TTS_EQUAL(is_commutative(o) , 0);
+  TTS_EQUAL(is_commutative(oc), 1);
+};
+
+TTS_CASE("Check mmm::op computations")
+{
+  std::vector<std::int32_t> in = {1, 2, 3, 4}, inout = {10, 20, 30, 40};
+
+  // inout[i] = f(in[i], inout[i])
+  auto f = [](std::int32_t a, std::int32_t b) { return 100*a + b; };
+  MPI_Reduce_local( in.data(), inout.data(), 4
+                  , mmm::datatype(mmm::type<std::int32_t>), mmm::op(f, mmm::type<std::int32_t>)
+                  );
+
+  TTS_EQUAL(inout, (std::vector<std::int32_t>{110, 220, 330, 440}));
+
+  auto merge = [](stats a, stats b) { return stats{a.sum + b.sum, a.count + b.count}; };
+  stats s[2] = { {1.5, 1}, {2.5, 3} }, r[2] = { {0.5, 2}, {4.0, 1} };
+
+  MPI_Reduce_local( s, r, 2
+                  , mmm::datatype(mmm::type<stats>)
+                  , mmm::op[mmm::commutative](merge, mmm::type<stats>)
+                  );
+
+  TTS_EQUAL(r[0].sum  , 2.0 );
+  TTS_EQUAL(r[0].count, 3   );
+  TTS_EQUAL(r[1].sum  , 6.5 );
+  TTS_EQUAL(r[1].count, 4   );
+};
+
+TTS_CASE("Check mmm::op in collective")
+{
+  int size;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  auto absmax = [](float a, float b) { return (a < 0 ? -a : a) < (b < 0 ? -b : b) ? b : a; };
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  float value = rank % 2 ? static_cast<float>(rank) : -static_cast<float>(rank), out;
+  MPI_Allreduce ( &value, &out, 1, mmm::datatype(mmm::type<float>)
+                , mmm::op[mmm::commutative](absmax, mmm::type<float>), MPI_COMM_WORLD
+                );
+
+  auto last = static_cast<float>(size-1);
+  TTS_EQUAL(out, (size-1) % 2 ? last : -last);
+};
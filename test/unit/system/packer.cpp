@@ -0,0 +1,135 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+  struct particle
+  {
+    double  x[3];
+    char    tag;
+    int     id;
+  };
+
+  // Pack through MPI_Pack as reference
+  template<typename T>
+  std::vector<char> reference(T const* data, int count, MPI_Datatype t)
+  {
+    int n, position = 0;
+    MPI_Pack_size(count, t, MPI_COMM_SELF, &n);
+    std::vector<char> out(static_cast<std::size_t>(n));
+    MPI_Pack(data, count, t, out.data(), n, &position, MPI_COMM_SELF);
+    out.resize(static_cast<std::size_t>(position));
+    return out;
+  }
+
+  template<typename T>
+  std::vector<char> packed(mmm::packer const& p, T const* data, int count)
+  {
+    std::vector<char> out(p.packed_size(count));
+    p.pack(data, count, out.data());
+    return out;
+  }
+}
+
+TTS_CASE("Check mmm::packer on vector and subarray layouts")
+{
+  std::vector<double> grid(8*8*8);
+  std::iota(grid.begin(), grid.end(), 0.);
+
+  mmm::view g(grid.data(), {8,8,8});
+  auto column = mmm::datatype(mmm::view(grid.data(), {64}, {8}));
+  auto face   = g.subview({1,2,0}, {4,5,8});
+
+  mmm::packer pc(column), pf(mmm::datatype(face));
+
+  TTS_EXPECT(pc.native());
+  TTS_EXPECT(pf.native());
+  TTS_EQUAL(pc.blocks(), 64ULL);
+  TTS_EQUAL(pf.blocks(), 4ULL );
+  TTS_EQUAL(pf.packed_size(1), 4*5*8*sizeof(double));
+
+  TTS_EQUAL(packed(pc, grid.data(), 1), reference(grid.data(), 1, column));
+  TTS_EQUAL(packed(pf, face.data(), 1), reference(face.data(), 1, mmm::datatype(face)));
+};
+
+TTS_CASE("Check mmm::packer layout of vectors with large strides")
+{
+  // Offsets of the last blocks don't fit in an int
+  MPI_Datatype t;
+  MPI_Type_vector(3, 1, 1 << 30, MPI_DOUBLE, &t);
+
+  std::vector<mmm::detail::block> blocks;
+  TTS_EXPECT(mmm::detail::flatten(t, 0, blocks));
+  TTS_EQUAL(blocks.size()     , 3ULL);
+  TTS_EQUAL(blocks[2].offset  , std::ptrdiff_t{2} * (1 << 30) * 8);
+
+  MPI_Type_free(&t);
+};
+
+TTS_CASE("Check mmm::packer on indexed layouts")
+{
+  std::vector<int> field(64);
+  std::iota(field.begin(), field.end(), 0);
+
+  std::vector<int> starts = {1, 9, 30, 31}, lengths = {3, 1, 1, 2};
+  mmm::indexed sel(field.data(), starts, lengths);
+  mmm::packer  p(mmm::datatype(sel));
+
+  TTS_EQUAL(p.blocks(), 3ULL);
+  TTS_EQUAL(packed(p, field.data(), 1), reference(field.data(), 1, mmm::datatype(sel)));
+};
+
+TTS_CASE("Check mmm::packer on struct layouts")
+{
+  std::vector<particle> ps(6);
+  for(std::size_t i = 0; i < ps.size(); ++i)
+  {
+    auto d = static_cast<double>(i);
+    ps[i] = particle{ {d,2*d,3*d}, static_cast<char>('a'+i), static_cast<int>(i) };
+  }
+
+  auto whole  = mmm::datatype(mmm::type<particle>);
+  auto part   = mmm::datatype(mmm::type<particle>, mmm::fields<&particle::id>);
+  mmm::packer pw(whole), pp(part);
+
+  TTS_EQUAL(pw.blocks(), 2ULL);
+  TTS_EQUAL(pp.blocks(), 1ULL);
+  TTS_EQUAL(packed(pw, ps.data(), 6), reference(ps.data(), 6, whole));
+  TTS_EQUAL(packed(pp, ps.data(), 6), reference(ps.data(), 6, part));
+
+  std::vector<particle> out(6, particle{{0,0,0}, 'z', -1});
+  auto bytes = packed(pw, ps.data(), 6);
+  pw.unpack(bytes.data(), out.data(), 6);
+
+  for(std::size_t i = 0; i < ps.size(); ++i)
+  {
+    TTS_EQUAL(out[i].x[1], ps[i].x[1]);
+    TTS_EQUAL(out[i].tag , ps[i].tag );
+    TTS_EQUAL(out[i].id  , ps[i].id  );
+  }
+};
+
+TTS_CASE("Check mmm::packer unpack on strided layouts")
+{
+  std::vector<float> in(16), out(32, -1.f);
+  std::iota(in.begin(), in.end(), 1.f);
+
+  mmm::packer p(mmm::datatype(mmm::view(out.data(), {16}, {2})));
+  p.unpack(in.data(), out.data(), 1);
+
+  for(std::size_t i = 0; i < in.size(); ++i)
+  {
+    TTS_EQUAL(out[2*i]  , in[i]);
+    TTS_EQUAL(out[2*i+1], -1.f );
+  }
+};
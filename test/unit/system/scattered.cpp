@@ -0,0 +1,90 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <climits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace
+{
+  // Send scattered elements to ourselves and receive them as a contiguous sequence of elements
+  template<typename T, typename U> std::vector<U> gather(mmm::scattered<T> const& x, mmm::type_t<U>)
+  {
+    std::vector<U> out(static_cast<std::size_t>(x.size()));
+    MPI_Sendrecv( x.data()  , 1                         , mmm::datatype(x)            , 0, 0
+                , out.data(), static_cast<int>(x.size()), mmm::datatype(mmm::type<U>) , 0, 0
+                , MPI_COMM_SELF, MPI_STATUS_IGNORE
+                );
+    return out;
+  }
+}
+
+TTS_CASE("Check mmm::scattered over a vector of vectors")
+{
+  std::vector<std::vector<int>> const adjacency = { {1,2,3}, {}, {4}, {5,6} };
+  mmm::scattered lists(adjacency);
+
+  TTS_EQUAL(lists.size(), 6);
+  TTS_EQUAL(lists.data(), MPI_BOTTOM);
+  TTS_EQUAL(gather(lists, mmm::type<int>), (std::vector<int>{1,2,3,4,5,6}));
+};
+
+TTS_CASE("Check mmm::scattered over a range of pointers")
+{
+  double a = 1.5, b = -2., c = 8.25;
+  std::vector<double*> pointers = { &c, &a, &b };
+  mmm::scattered values(pointers);
+
+  TTS_EQUAL(values.size(), 3);
+  TTS_EQUAL(gather(values, mmm::type<double>), (std::vector<double>{8.25,1.5,-2.}));
+
+  std::vector<double> x(4, 1.), y(2, 2.);
+  std::vector<double*> blocks   = { y.data(), x.data() };
+  std::vector<int>     lengths  = { 2, 3 };
+  mmm::scattered       chunks(blocks, lengths);
+
+  TTS_EQUAL(chunks.size(), 5);
+  TTS_EQUAL(gather(chunks, mmm::type<double>), (std::vector<double>{2,2,1,1,1}));
+};
+
+TTS_CASE("Check mmm::scattered as receive buffer")
+{
+  std::vector<float>              in  = {1,2,3,4,5,6,7};
+  std::vector<std::vector<float>> out = { std::vector<float>(2), std::vector<float>(4)
+                                        , std::vector<float>(1)
+                                        };
+  {
+    mmm::scattered dst(out);
+    MPI_Sendrecv( in.data() , 7, mmm::datatype(mmm::type<float>), 0, 0
+                , dst.data(), 1, mmm::datatype(dst)             , 0, 0
+                , MPI_COMM_SELF, MPI_STATUS_IGNORE
+                );
+  }
+
+  TTS_EQUAL(out[0], (std::vector<float>{1,2}));
+  TTS_EQUAL(out[1], (std::vector<float>{3,4,5,6}));
+  TTS_EQUAL(out[2], (std::vector<float>{7}));
+};
+
+TTS_CASE("Check mmm::scattered over blocks longer than an int can count")
+{
+  // The block is only described, never accessed, so its memory is left uncommitted
+  constexpr std::size_t n = std::size_t{INT_MAX} + 5;
+  std::unique_ptr<char[]> data(new char[n]);
+  std::vector<std::span<char>> blocks = { std::span<char>(data.get(), n) };
+
+  mmm::scattered<char> large(blocks);
+  TTS_EQUAL(large.size(), static_cast<std::ptrdiff_t>(n));
+  TTS_NOT_EQUAL(mmm::datatype(large), MPI_DATATYPE_NULL);
+
+  MPI_Count size;
+  MPI_Type_size_x(mmm::datatype(large), &size);
+  TTS_EQUAL(size, static_cast<MPI_Count>(n));
+};
@@ -0,0 +1,56 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include <mmm/mmm.hpp>
+#include <iostream>
+#include <memory>
+
+int main()
+{
+#if MPI_VERSION >= 4
+  bool valid = true;
+
+  {
+    mmm::session mpi_session;
+
+    std::cout << "Process     : " << mpi_session.rank << "/" << mpi_session.size << "\n";
+    std::cout << "Host        : " << mpi_session.node_id << "\n";
+
+    auto self = mpi_session.open("mpi://SELF");
+    mpi_session.synchronize();
+
+    valid = mpi_session.rank < mpi_session.size && self.size() == 1 && self.rank() == 0;
+  }
+
+  // Sessions destroyed out of order leave the registry of the surviving one active
+  {
+    auto first  = std::make_unique<mmm::session>();
+    mmm::session second("mpi://SELF");
+
+    auto op = [](int a, int b) { return a > b ? a : b; };
+    mmm::op(op, mmm::type<int>);
+    first.reset();
+
+    struct pair_t { int a; double b; };
+    pair_t in{1, 2.5}, out{};
+    auto t = mmm::datatype(mmm::type<pair_t>);
+    MPI_Sendrecv( &in , 1, t, 0, 0, &out, 1, t, 0, 0
+                , second.world().handle(), MPI_STATUS_IGNORE
+                );
+
+    int r = 3, m = 0;
+    MPI_Allreduce(&r, &m, 1, MPI_INT, mmm::op(op, mmm::type<int>), second.world().handle());
+
+    valid = valid && out.a == 1 && out.b == 2.5 && m == 3;
+  }
+
+  return valid ? 0 : 1;
+#else
+  std::cout << "MPI Sessions require MPI-4, skipped.\n";
+  return 0;
+#endif
+}
@@ -0,0 +1,81 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <vector>
+
+namespace
+{
+  struct particle
+  {
+    double  x, y, z;
+    char    kind;
+    int     id;
+  };
+
+  std::vector<particle> make(std::size_t n)
+  {
+    std::vector<particle> ps(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      auto d = static_cast<double>(i);
+      ps[i] = particle{d, 10*d, 100*d, static_cast<char>('a'+i), static_cast<int>(i)};
+    }
+    return ps;
+  }
+}
+
+TTS_CASE("Check mmm::soa datatype with members of identical size")
+{
+  auto ps = make(7);
+  std::vector<double> x(7), z(7);
+
+  auto proj = mmm::fields<&particle::x, &particle::z>;
+  mmm::soa dst(mmm::type<particle>, proj, x.size(), x.data(), z.data());
+
+  TTS_EXPECT(decltype(dst)::uniform);
+  TTS_EQUAL(dst.data(), MPI_BOTTOM);
+
+  MPI_Sendrecv( ps.data() , 7, mmm::datatype(mmm::type<particle>, proj) , 0, 0
+              , dst.data(), 1, mmm::datatype(dst)                       , 0, 0
+              , MPI_COMM_SELF, MPI_STATUS_IGNORE
+              );
+
+  for(std::size_t i = 0; i < ps.size(); ++i)
+  {
+    TTS_EQUAL(x[i], ps[i].x);
+    TTS_EQUAL(z[i], ps[i].z);
+  }
+};
+
+TTS_CASE("Check mmm::recv into mmm::soa with members of different sizes")
+{
+  auto ps = make(5);
+  std::vector<double> y(8, -1.);
+  std::vector<int>    id(8, -1);
+  std::vector<char>   kind(8, '?');
+
+  auto proj = mmm::fields<&particle::id, &particle::y, &particle::kind>;
+  mmm::soa dst(mmm::type<particle>, proj, y.size(), id.data(), y.data(), kind.data());
+
+  TTS_EXPECT_NOT(decltype(dst)::uniform);
+
+  MPI_Send(ps.data(), 5, mmm::datatype(mmm::type<particle>, proj), 0, 3, MPI_COMM_SELF);
+  auto st = mmm::recv(dst, 0, 3, MPI_COMM_SELF);
+
+  TTS_EQUAL(st.MPI_TAG, 3);
+  for(std::size_t i = 0; i < ps.size(); ++i)
+  {
+    TTS_EQUAL(y[i]   , ps[i].y   );
+    TTS_EQUAL(id[i]  , ps[i].id  );
+    TTS_EQUAL(kind[i], ps[i].kind);
+  }
+
+  TTS_EQUAL(y[5] , -1.);
+  TTS_EQUAL(id[7], -1 );
+};
@@ -0,0 +1,121 @@
+//==================================================================================================
+/*
+  MMM - Massively Modernized MPI for C++20
+  Copyright : MMM Contributors & Maintainers
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#include "test.hpp"
+#include <mmm/mmm.hpp>
+#include <climits>
+#include <vector>
+
+namespace
+{
+  // Send a view to ourselves and receive it as a contiguous sequence of elements
+  template<typename T, std::size_t R> std::vector<T> gather(mmm::view<T,R> const& v)
+  {
+    std::vector<T> out(static_cast<std::size_t>(v.size()));
+    MPI_Sendrecv( v.data()  , 1                         , mmm::datatype(v)            , 0, 0
+                , out.data(), static_cast<int>(v.size()), mmm::datatype(mmm::type<T>) , 0, 0
+                , MPI_COMM_SELF, MPI_STATUS_IGNORE
+                );
+    return out;
+  }
+
+  int combiner_of(MPI_Datatype t)
+  {
+    int ni, na, nd, combiner;
+    MPI_Type_get_envelope(t, &ni, &na, &nd, &combiner);
+    return combiner;
+  }
+}
+
+TTS_CASE("Check mmm::view layout")
+{
+  std::vector<int> data(24);
+  mmm::view v(data.data(), {2,3,4});
+
+  TTS_EQUAL(v.rank()        , 3u  );
+  TTS_EQUAL(v.size()        , 24  );
+  TTS_EQUAL(v.strides()[0]  , 12  );
+  TTS_EQUAL(v.strides()[1]  , 4   );
+  TTS_EQUAL(v.strides()[2]  , 1   );
+
+  auto s = v.subview({1,1,2}, {1,2,2});
+  TTS_EQUAL(s.data()    , data.data() + 12 + 4 + 2);
+  TTS_EQUAL(s.size()    , 4 );
+  TTS_EQUAL(s.strides() , v.strides());
+};
+
+TTS_CASE("Check mmm::view datatype for matrix columns and tiles")
+{
+  std::vector<double> m(6*5);
+  for(std::size_t i = 0; i < m.size(); ++i) m[i] = static_cast<double>(i);
+
+  mmm::view mat(m.data(), {6,5});
+
+  auto col = mat.subview({0,3}, {6,1});
+  TTS_EQUAL(combiner_of(mmm::datatype(col)), MPI_COMBINER_VECTOR);
+  TTS_EQUAL(gather(col), (std::vector<double>{3,8,13,18,23,28}));
+
+  auto tile = mat.subview({2,1}, {2,3});
+  TTS_EQUAL(combiner_of(mmm::datatype(tile)), MPI_COMBINER_VECTOR);
+  TTS_EQUAL(gather(tile), (std::vector<double>{11,12,13,16,17,18}));
+
+  // Same shape, different location: datatype is reused
+  TTS_EQUAL(mmm::datatype(mat.subview({0,1}, {6,1})), mmm::datatype(col));
+};
+
+TTS_CASE("Check mmm::view datatype for 3D halo faces")
+{
+  std::vector<float> g(4*3*5);
+  for(std::size_t i = 0; i < g.size(); ++i) g[i] = static_cast<float>(i);
+
+  mmm::view grid(g.data(), {4,3,5});
+
+  auto xface = grid.subview({3,0,0}, {1,3,5});
+  auto zface = grid.subview({0,0,4}, {4,3,1});
+
+  TTS_EQUAL(combiner_of(mmm::datatype(zface)), MPI_COMBINER_SUBARRAY);
+  TTS_EQUAL(gather(xface), (std::vector<float>(g.begin()+45, g.end())));
+  TTS_EQUAL ( gather(zface)
+            , (std::vector<float>{4,9,14,19,24,29,34,39,44,49,54,59})
+            );
+};
+
+TTS_CASE("Check mmm::view datatype for arbitrary strides")
+{
+  std::vector<std::int32_t> m(4*4);
+  for(std::size_t i = 0; i < m.size(); ++i) m[i] = static_cast<std::int32_t>(i);
+
+  // Transposed view of the top-left 2x3 block
+  mmm::view t(m.data(), {3,2}, {1,4});
+  TTS_EQUAL(combiner_of(mmm::datatype(t)), MPI_COMBINER_HVECTOR);
+  TTS_EQUAL(gather(t), (std::vector<std::int32_t>{0,4,1,5,2,6}));
+};
+
+TTS_CASE("Check mmm::view datatype for strides and extents larger than an int")
+{
+  constexpr std::ptrdiff_t far = std::ptrdiff_t{1} << 32;
+
+  auto extent_of = [](MPI_Datatype t)
+  {
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(t, &lb, &extent);
+    return extent;
+  };
+
+  // Large strides are described in bytes
+  mmm::view<char,1> column(nullptr, {2}, {far});
+  TTS_EQUAL(combiner_of(mmm::datatype(column)), MPI_COMBINER_HVECTOR);
+  TTS_EQUAL(extent_of(mmm::datatype(column)), MPI_Aint{far + 1});
+
+  mmm::view<char,2> tile(nullptr, {2,2}, {far,1});
+  TTS_EQUAL(combiner_of(mmm::datatype(tile)), MPI_COMBINER_HVECTOR);
+  TTS_EQUAL(extent_of(mmm::datatype(tile)), MPI_Aint{far + 2});
+
+  // Extents an int can't count have no datatype
+  mmm::view<char,1> huge(nullptr, {std::ptrdiff_t{INT_MAX} + 1});
+  TTS_EQUAL(mmm::datatype(huge), MPI_DATATYPE_NULL);
+};